@@ -139,6 +139,16 @@ namespace OKlib {
        //! whether the buffer is empty
        bool empty() const { return next_lit == phi.end(); }
 
+       //! all literals assigned to true (in the order of assignment)
+       const std::vector<literal_type>& literals() const { return phi; }
+       //! unassigning all variables (also emptying the buffer)
+       void clear() {
+         for (const literal_type x : phi)
+           V[index_type(OKlib::Literals::var(x))] = OKlib::Satisfiability::Values::unassigned;
+         phi.clear();
+         next_lit = phi.begin();
+       }
+
      private :
 
        index_type n;
@@ -0,0 +1,520 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file Interfaces/DistributedSolving/Conquer.hpp
+  \brief Components for conquering the cubes of a splitting in-process
+
+  Instead of creating a file for each sub-instance (via ApplyPass) and
+  running a solver-process on it (as ProcessSplitViaOKsolver does), the
+  base-instance is read once, and each cube is applied (by unit-clause
+  propagation, using CLSAdaptorUcpW) and solved by a backend within the
+  same process, by several worker-threads.
+
+  <ul>
+   <li> read_split_directory and read_split_file read the cubes as created
+   by SplittingViaOKsolver resp. by the OKsolver with options "-S" and
+   "-SF"; read_split_result reads the result of the OKsolver from the
+   directory (which might have already decided the instance). </li>
+   <li> SplitStream reads the cubes one after another, together with their
+   decisions. </li>
+   <li> BaseFormula is the CLSAdaptor for the base-instance. </li>
+   <li> conquer(F, cubes, threads, out) solves the cubes, streaming a line
+   per cube to out. </li>
+   <li> ucp_cubes(F, S, threads, batch, out) only performs unit-clause
+   propagation for the decisions and for the whole cubes from S. </li>
+  </ul>
+
+  The concept of a backend B (solving the sub-instances):
+  <ul>
+   <li> B::init(F) is called (once) in the main thread, for the base-instance
+   F, before the worker-threads are started. </li>
+   <li> Each worker-thread constructs its own backend-object b. </li>
+   <li> b(U) solves the sub-instance given by U, the CLSAdaptorUcpW-object
+   after unit-clause propagation (not found inconsistent) of the cube, where
+   U.assignment().literals() are the literals set to true, and where
+   U.output(A) transfers the reduced clause-set to a CLSAdaptor A; the
+   result is of type Result. </li>
+   <li> B::stop() (asynchronously) stops all running b(U) (which then
+   return unknown, if not finished). </li>
+   <li> The string B::name describes the backend. </li>
+  </ul>
+
+  \todo Further backends
+  <ul>
+   <li> Currently only the core of the tawSolver is available (see
+   ConquerSplitViaOKsolver.cpp). </li>
+   <li> The OKsolver_2002 keeps all its state in global variables, and can
+   run only once per process at a time; so it could only be used with a
+   single worker-thread. </li>
+  </ul>
+
+*/
+
+#ifndef CONQUER_hJk8Rt3Yp
+#define CONQUER_hJk8Rt3Yp
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <ostream>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+
+#include <OKlib/Satisfiability/ProblemInstances/Clauses/WatchedLiterals.hpp>
+#include <OKlib/Satisfiability/Assignments/TotalAssignments/AssignmentsWithBuffer.hpp>
+#include <OKlib/Satisfiability/Reductions/UnitClausePropagation/ClsAdaptorUCP.hpp>
+
+namespace OKlib {
+  namespace Satisfiability {
+    namespace Interfaces {
+      namespace DistributedSolving {
+
+        typedef std::uint64_t count_type;
+
+        struct SplitReadingError : std::runtime_error {
+          SplitReadingError(const std::string& m) : std::runtime_error(m) {}
+        };
+
+        /*!
+          \class Cube
+          \brief A cube (partial assignment) from a splitting
+
+          i is the index in the order of processing, F the index of the
+          cube as created by the OKsolver, npa the number of literals, and
+          d the number of decisions (as read by SplitStream, the decisions
+          are then the first d literals).
+        */
+        template <typename Lit>
+        struct Cube {
+          typedef Lit literal_type;
+          count_type i, F, npa, d;
+          std::vector<literal_type> lits;
+        };
+
+        namespace detail {
+          /* Reading "v x_1 ... x_k 0" as in ReadPass (Interfaces/InputOutput/
+             PartialAssignments.hpp), but keeping the order of the literals
+             (to which the indices of the decisions refer):
+          */
+          template <typename Lit>
+          std::vector<Lit> read_cube(std::istream& in, const std::string& where) {
+            std::string token;
+            if (not (in >> token) or token != "v")
+              throw SplitReadingError("Invalid cube in " + where + ".");
+            std::vector<Lit> C;
+            for (Lit x; (in >> x) and x != 0;) {
+              if (x == std::numeric_limits<Lit>::min())
+                throw SplitReadingError("Invalid cube in " + where + ".");
+              C.push_back(x);
+            }
+            if (not in)
+              throw SplitReadingError("Invalid cube in " + where + ".");
+            std::vector<Lit> S(C);
+            std::sort(S.begin(), S.end());
+            for (const Lit x : S)
+              if (x < 0 and std::binary_search(S.begin(), S.end(), -x))
+                throw SplitReadingError("Contradictory cube in " + where + ".");
+            return C;
+          }
+        }
+
+        /*!
+          \brief Reading the directory created by SplittingViaOKsolver
+
+          The cubes are in the order of file Data, with their partial
+          assignments from subdirectory Instances; returns the path of the
+          base-instance via reference-parameter instance.
+        */
+        template <typename Lit>
+        std::vector<Cube<Lit> > read_split_directory(const std::filesystem::path& dir, std::filesystem::path& instance) {
+          {std::ifstream f(dir / "F");
+           std::string name;
+           if (not std::getline(f, name) or name.empty())
+             throw SplitReadingError("Can not read file " + (dir / "F").string() + ".");
+           instance = dir / name;
+          }
+          std::ifstream data(dir / "Data");
+          std::string line;
+          if (not std::getline(data, line))
+            throw SplitReadingError("Can not read file " + (dir / "Data").string() + ".");
+          std::vector<Cube<Lit> > cubes;
+          while (std::getline(data, line)) {
+            std::istringstream s(line);
+            Cube<Lit> c;
+            if (not (s >> c.i >> c.F >> c.npa >> c.d))
+              throw SplitReadingError("Invalid line " + std::to_string(cubes.size()+2) + " in " + (dir / "Data").string() + ".");
+            const std::filesystem::path file = dir / "Instances" / std::to_string(c.F);
+            std::ifstream in(file);
+            if (not in) throw SplitReadingError("Can not open file " + file.string() + ".");
+            c.lits = detail::read_cube<Lit>(in, file.string());
+            cubes.push_back(std::move(c));
+          }
+          return cubes;
+        }
+
+        /*!
+          \brief Reading the result of the OKsolver-run from file Result in
+          the directory created by SplittingViaOKsolver
+
+          Returns "SATISFIABLE", "UNSATISFIABLE" or "UNKNOWN" (as in the
+          s-line), or the empty string if not available. If the OKsolver
+          found a satisfying assignment, then it stopped splitting.
+        */
+        inline std::string read_split_result(const std::filesystem::path& dir) {
+          std::ifstream f(dir / "Result");
+          std::string line;
+          if (not std::getline(f, line) or line.size() <= 2 or line.substr(0,2) != "s ")
+            return "";
+          return line.substr(2);
+        }
+
+        /*!
+          \brief Reading the file created by the OKsolver with options
+          "-S=file -SF"
+
+          The cubes are the lines of file (in this order), while the number
+          of decisions are read from file_decisions (if it exists; otherwise
+          they are zero).
+        */
+        template <typename Lit>
+        std::vector<Cube<Lit> > read_split_file(const std::filesystem::path& file) {
+          std::ifstream in(file);
+          if (not in) throw SplitReadingError("Can not open file " + file.string() + ".");
+          std::ifstream dec(file.string() + "_decisions");
+          std::vector<Cube<Lit> > cubes;
+          for (std::string line; std::getline(in, line);) {
+            if (line.empty()) continue;
+            Cube<Lit> c;
+            c.i = c.F = cubes.size() + 1;
+            std::istringstream s(line);
+            c.lits = detail::read_cube<Lit>(s, "line " + std::to_string(c.F) + " of " + file.string());
+            c.npa = c.lits.size();
+            c.d = 0;
+            if (dec) {
+              dec >> c.d;
+              dec.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            }
+            cubes.push_back(std::move(c));
+          }
+          return cubes;
+        }
+
+        /*!
+          \class SplitStream
+          \brief Reading the cubes of a splitting one after another, together
+          with their decisions
+
+          For a directory created by SplittingViaOKsolver the cubes are read
+          in the order of their creation (files Instances/1, 2, ...), for a
+          file created by the OKsolver with options "-S=file -SF" in the order
+          of the lines. Line i of Instances/decisions resp. file_decisions
+          contains the number of decisions of cube i, followed by their
+          (zero-based) indices in cube i. The decisions are moved to the
+          front of Cube::lits (otherwise the order is kept), and Cube::i and
+          Cube::F are both the index of the cube.
+        */
+        template <typename Lit>
+        class SplitStream {
+          std::filesystem::path instance_, dir_, dec_name;
+          std::ifstream cubes, decisions;
+          count_type count = 0;
+        public :
+          explicit SplitStream(const std::filesystem::path& p) {
+            if (std::filesystem::is_directory(p)) {
+              std::ifstream f(p / "F");
+              std::string name;
+              if (not std::getline(f, name) or name.empty())
+                throw SplitReadingError("Can not read file " + (p / "F").string() + ".");
+              instance_ = p / name;
+              dir_ = p / "Instances";
+              dec_name = dir_ / "decisions";
+            }
+            else {
+              cubes.open(p);
+              if (not cubes) throw SplitReadingError("Can not open file " + p.string() + ".");
+              dec_name = p.string() + "_decisions";
+            }
+            decisions.open(dec_name);
+            if (not decisions) throw SplitReadingError("Can not open file " + dec_name.string() + ".");
+          }
+
+          //! the base-instance (only for a directory, otherwise empty)
+          const std::filesystem::path& instance() const { return instance_; }
+
+          //! reading the next cube into c, returning false if there is none
+          bool next(Cube<Lit>& c) {
+            std::vector<Lit> C;
+            std::string where;
+            if (dir_.empty()) {
+              std::string line;
+              do if (not std::getline(cubes, line)) return false;
+              while (line.empty());
+              where = "cube " + std::to_string(count+1) + " of the split-file";
+              std::istringstream s(line);
+              C = detail::read_cube<Lit>(s, where);
+            }
+            else {
+              if (decisions.peek() == std::char_traits<char>::eof()) return false;
+              const std::filesystem::path file = dir_ / std::to_string(count+1);
+              std::ifstream in(file);
+              if (not in) throw SplitReadingError("Can not open file " + file.string() + ".");
+              where = file.string();
+              C = detail::read_cube<Lit>(in, where);
+            }
+            std::string line;
+            if (not std::getline(decisions, line))
+              throw SplitReadingError("Missing decisions for " + where + ".");
+            std::istringstream s(line);
+            count_type d;
+            if (not (s >> d) or d > C.size())
+              throw SplitReadingError("Invalid decisions for " + where + ".");
+            std::vector<char> dec(C.size());
+            c.lits.clear();
+            for (count_type j = 0; j < d; ++j) {
+              count_type k;
+              if (not (s >> k) or k >= C.size() or dec[k])
+                throw SplitReadingError("Invalid decisions for " + where + ".");
+              dec[k] = true;
+              c.lits.push_back(C[k]);
+            }
+            for (count_type k = 0; k < C.size(); ++k)
+              if (not dec[k]) c.lits.push_back(C[k]);
+            c.i = c.F = ++count;
+            c.npa = C.size();
+            c.d = d;
+            return true;
+          }
+        };
+
+        /*!
+          \class BaseFormula
+          \brief CLSAdaptor storing the base-instance
+
+          As provided by the Dimacs-input, the clauses contain no repeated
+          literals, and tautological clauses are not stored.
+        */
+        template <typename Lit>
+        struct BaseFormula {
+          typedef Lit literal_type;
+          typedef literal_type int_type;
+          typedef std::string string_type;
+          typedef std::vector<literal_type> clause_type;
+          typedef std::vector<clause_type> clause_set_type;
+
+          int_type n_ = 0, c_ = 0;
+          clause_set_type clauses;
+
+          void comment(const string_type&) const {}
+          void n(const int_type n) { n_ = n; }
+          void c(const int_type c) { c_ = c; clauses.reserve(c); }
+          void finish() const {}
+          void tautological_clause(int_type) const {}
+          template <class Range>
+          void clause(const Range& C, int_type) {
+            clauses.push_back(clause_type(C.begin(), C.end()));
+          }
+
+          //! transferring the clauses to the CLSAdaptor A
+          template <class CLSAdaptor>
+          void transfer(CLSAdaptor& A) const {
+            A.n(n_); A.c(clauses.size());
+            for (const clause_type& C : clauses) A.clause(C, C.size());
+            A.finish();
+          }
+        };
+
+        //! the results for a sub-instance
+        enum class Status { unsat = 0, sat = 1, unknown = 2 };
+        struct Result {
+          Status s;
+          count_type nodes;
+        };
+
+        //! the unit-clause-propagation used for applying the cubes
+        template <typename Lit>
+        using ucp_type = OKlib::Satisfiability::Reductions::UnitClausePropagation::CLSAdaptorUcpW<
+          OKlib::Satisfiability::ProblemInstances::Clauses::WatchedLiterals_mono<Lit>,
+          OKlib::Satisfiability::Assignments::TotalAssignments::BAssignmentWithQueue<Lit> >;
+
+        //! the totals over all cubes
+        struct Summary {
+          count_type conquered = 0, sat = 0, unknown = 0, refuted_ucp = 0;
+          std::chrono::duration<double> time{};
+        };
+
+        /*!
+          \brief Conquering the cubes by threads many worker-threads, using
+          Backend
+
+          Each worker-thread has its own unit-clause-propagation (built
+          once from F), and takes the next cube: its literals are added as
+          unit-clauses, and if unit-clause propagation doesn't find a
+          contradiction, the backend solves the sub-instance.
+          For each cube the line
+            i F npa d nucp sat nds tucp tsol
+          is output (in the order of completion, after the header-line),
+          where nucp is the number of variables assigned after unit-clause
+          propagation (including the unit-clauses of F), sat is 0, 1 or 2
+          (unknown), nds the number of nodes of the backend, and tucp, tsol
+          are the wall-clock times (in sec) for the unit-clause-propagation
+          resp. for the backend.
+          After the first satisfiable cube, all workers are stopped, and the
+          remaining cubes are not processed.
+        */
+        template <class Backend, typename Lit>
+        Summary conquer(const BaseFormula<Lit>& F, const std::vector<Cube<Lit> >& cubes, const unsigned threads, std::ostream& out) {
+          assert(threads >= 1);
+          typedef std::chrono::steady_clock clock;
+          const auto t0 = clock::now();
+          Backend::init(F);
+          Summary S;
+          std::mutex m;
+          std::atomic<std::size_t> next{0};
+          std::atomic<bool> stop{false};
+          out << "i F npa d nucp sat nds tucp tsol" << std::endl;
+          const auto work = [&]{
+            ucp_type<Lit> U;
+            F.transfer(U);
+            Backend b;
+            for (std::size_t j; not stop.load(std::memory_order_relaxed) and
+                   (j = next.fetch_add(1, std::memory_order_relaxed)) < cubes.size();) {
+              const Cube<Lit>& c = cubes[j];
+              const auto t1 = clock::now();
+              U.reset();
+              for (const Lit x : c.lits) U.push_unit_clause(x);
+              const bool refuted = U.perform_ucp();
+              const count_type nucp = U.assignment().literals().size();
+              const auto t2 = clock::now();
+              const Result r = refuted ? Result{Status::unsat, 0} : b(U);
+              const auto t3 = clock::now();
+              if (r.s == Status::sat and not stop.exchange(true)) Backend::stop();
+              const std::chrono::duration<double> tucp = t2 - t1, tsol = t3 - t2;
+              const std::lock_guard lock(m);
+              ++S.conquered;
+              S.sat += r.s == Status::sat;
+              S.unknown += r.s == Status::unknown;
+              S.refuted_ucp += refuted;
+              out << c.i << " " << c.F << " " << c.npa << " " << c.d << " "
+                  << nucp << " " << int(r.s) << " " << r.nodes << " "
+                  << std::fixed << std::setprecision(4) << tucp.count()
+                  << " " << tsol.count() << std::endl;
+            }
+          };
+          {std::vector<std::thread> workers;
+           workers.reserve(threads);
+           for (unsigned i = 0; i < threads; ++i) workers.emplace_back(work);
+           for (auto& w : workers) w.join();
+          }
+          S.time = clock::now() - t0;
+          return S;
+        }
+
+        //! the results of unit-clause propagation for a cube
+        struct UcpResult {
+          count_type nucpd, nucp;
+          int c;
+        };
+
+        namespace detail {
+          template <typename Lit>
+          UcpResult ucp_cube(ucp_type<Lit>& U, const Cube<Lit>& c) {
+            assert(c.d <= c.lits.size());
+            const auto& pa = U.assignment().literals();
+            const auto mid = c.lits.begin() + c.d;
+            U.reset();
+            for (auto i = c.lits.begin(); i != mid; ++i) U.push_unit_clause(*i);
+            if (U.perform_ucp()) return {pa.size(), pa.size(), 2};
+            const count_type nucpd = pa.size();
+            for (auto i = mid; i != c.lits.end(); ++i) U.push_unit_clause(*i);
+            const bool refuted = U.perform_ucp();
+            return {nucpd, pa.size(), refuted};
+          }
+        }
+
+        /*!
+          \brief Unit-clause propagation for the decisions and for the whole
+          cubes from S, using threads many worker-threads
+
+          The cubes are read in batches of size batch; while the workers
+          process the current batch, the next batch is read. Each worker has
+          its own unit-clause-propagation (built once from F, only resetting
+          the assignment per cube), and the unit-clause-propagation for the
+          whole cube just continues the one for the decisions.
+          For each cube the line
+            F npa d nucpd nucp c
+          is output (in the order of S, after the header-line), where nucpd
+          resp. nucp is the number of variables assigned after unit-clause
+          propagation of the decisions resp. of the whole cube (including
+          the unit-clauses of F), while c is 0 if no contradiction was found,
+          1 if one was found for the cube, and 2 if one was already found for
+          the decisions.
+          Returns the number of cubes; throws SplitReadingError also for
+          variables greater than F.n_.
+        */
+        template <typename Lit>
+        count_type ucp_cubes(const BaseFormula<Lit>& F, SplitStream<Lit>& S, const unsigned threads, const std::size_t batch, std::ostream& out) {
+          assert(threads >= 1 and batch >= 1);
+          typedef std::vector<Cube<Lit> > batch_t;
+          std::vector<ucp_type<Lit> > U(threads);
+          {std::vector<std::jthread> workers;
+           for (unsigned t = 0; t < threads; ++t)
+             workers.emplace_back([&F,&U,t]{F.transfer(U[t]);});
+          }
+          const auto read = [&F,&S,batch](batch_t& B) {
+            B.resize(batch);
+            std::size_t j = 0;
+            for (; j < batch and S.next(B[j]); ++j)
+              for (const Lit x : B[j].lits)
+                if (x > F.n_ or x < -F.n_)
+                  throw SplitReadingError("Variable in cube " + std::to_string(B[j].F) + " is greater than n = " + std::to_string(F.n_) + ".");
+            B.resize(j);
+          };
+          out << "F npa d nucpd nucp c\n";
+          batch_t current, next_batch;
+          std::vector<UcpResult> R;
+          read(current);
+          count_type count = 0;
+          while (not current.empty()) {
+            R.resize(current.size());
+            {std::atomic<std::size_t> next{0};
+             std::vector<std::jthread> workers;
+             for (unsigned t = 0; t < threads; ++t)
+               workers.emplace_back([&,t]{
+                 for (std::size_t j; (j = next.fetch_add(1, std::memory_order_relaxed)) < current.size();)
+                   R[j] = detail::ucp_cube(U[t], current[j]);
+               });
+             read(next_batch);
+            }
+            for (std::size_t j = 0; j < current.size(); ++j) {
+              const Cube<Lit>& c = current[j];
+              out << c.F << " " << c.npa << " " << c.d << " " << R[j].nucpd
+                  << " " << R[j].nucp << " " << R[j].c << "\n";
+            }
+            count += current.size();
+            current.swap(next_batch);
+          }
+          out.flush();
+          return count;
+        }
+
+      }
+    }
+  }
+}
+
+#endif
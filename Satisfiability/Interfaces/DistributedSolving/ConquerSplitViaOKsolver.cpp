@@ -0,0 +1,224 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file Interfaces/DistributedSolving/ConquerSplitViaOKsolver.cpp
+  \brief Application for solving the sub-instances of a splitting in-process
+
+  Replaces ProcessSplitViaOKsolver (with its process and file per cube) by
+  one process, using the components from Conquer.hpp, and the core of the
+  tawSolver as backend.
+
+  Usage:
+
+    ConquerSplitViaOKsolver SplitViaOKsolver_dir [threads]
+
+  conquers the cubes from the directory created by SplittingViaOKsolver
+  (in the order given by file Data, for the instance given by file F;
+  if according to file Result the OKsolver already found a satisfying
+  assignment, then no cube is conquered), while
+
+    ConquerSplitViaOKsolver instance.cnf split_file [threads]
+
+  uses the cubes as created by the OKsolver with options "-S=split_file -SF"
+  for instance.cnf (the OKsolver must be compiled without tree-resolution,
+  as OKsolver2002_NTP); split_file only contains the remaining cubes, and so
+  if the OKsolver already found a satisfying assignment while splitting
+  (which is not recorded in split_file), then an unsatisfiability-result is wrong.
+  The default for threads is the number of hardware threads.
+
+  To standard output the table with the results for the cubes is output
+  (see conquer in Conquer.hpp), followed by a summary in lines starting
+  with "#" (so that the output can be read by read.table in R).
+  Return-values are 10 (sat), 20 (unsat), and 0 (no result), as for
+  SAT-solvers.
+
+  The base-instance is read by the Dimacs-input of the OKlibrary (thus
+  unit-clauses and empty clauses are allowed, which are handled by the
+  unit-clause propagation), and then handed over to the tawSolver, which
+  runs in the worker-threads with its own copy of the formula (as for the
+  parallel search of the tawSolver, but without stealing work), and which
+  gets the assignment after unit-clause propagation as cube (see
+  "Cube-and-conquer" in Solvers/TawSolver/tawSolver.cpp).
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <thread>
+#include <exception>
+
+#include <OKlib/Satisfiability/Interfaces/InputOutput/Dimacs.hpp>
+#include <OKlib/Satisfiability/Interfaces/DistributedSolving/Conquer.hpp>
+
+#define PARALLEL
+#define SOLVER_CORE
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include <OKlib/Satisfiability/Solvers/TawSolver/tawSolver.cpp>
+#pragma GCC diagnostic pop
+
+namespace {
+
+  enum {
+    errcode_parameter = 1,
+    errcode_split = 2,
+    errcode_instance = 3
+  };
+
+  const std::string program_name = "ConquerSplitViaOKsolver";
+  const std::string err = "ERROR[" + program_name + "]: ";
+
+  const std::string conquer_version = "0.1.0";
+
+  namespace DS = OKlib::Satisfiability::Interfaces::DistributedSolving;
+  typedef Lit_int literal_type;
+
+  // The core of the tawSolver as backend (see Conquer.hpp for the concept):
+  class TawSolverCore {
+    // The formula of the main thread, copied by the workers:
+    inline static const Clauses* F0 = nullptr;
+    inline static const LiteralOccurrences* L0 = nullptr;
+    Lit_vec cube;
+  public :
+    inline static const std::string name = program + " " + version;
+    static void init(const DS::BaseFormula<literal_type>& F) {
+      load_formula(F.n_, F.clauses);
+      if (not n_clauses) return;
+      try { initialisation(); }
+      catch (const std::bad_alloc&) {
+        errout << "Allocation error with initialisation of algorithmic"
+          " data structures.";
+        std::exit(allocation_error);
+      }
+      F0 = &clauses; L0 = &lits;
+    }
+    static void stop() { pool.halt(); }
+    TawSolverCore() {
+      if (not n_clauses) return;
+      try { thread_initialisation(); copy_formula(*F0, *L0); }
+      catch (const std::bad_alloc&) {
+        errout << "Allocation error with initialisation of worker.";
+        std::exit(allocation_error);
+      }
+    }
+    template <class UCP>
+    DS::Result operator()(const UCP& U) {
+      if (not n_clauses) return {DS::Status::sat, 0};
+      cube.clear();
+      for (const literal_type x : U.assignment().literals())
+        if (var(Lit(x)) <= max_occ_var) cube.push_back(Lit(x));
+      const Count_statistics n0 = n_nodes;
+      const bool sat = conquer(cube.data(), cube.data() + cube.size());
+      return {sat ? DS::Status::sat : pool.stopped() ?
+                DS::Status::unknown : DS::Status::unsat,
+              DS::count_type(n_nodes - n0)};
+    }
+  };
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (argc < 2 or argc > 4) {
+    std::cerr << err << "Usage:\n  " << program_name <<
+      " SplitViaOKsolver_dir [threads]\n  " << program_name <<
+      " instance.cnf split_file [threads]\n";
+    return errcode_parameter;
+  }
+
+  std::filesystem::path instance;
+  std::vector<DS::Cube<literal_type>> cubes;
+  std::string split_result;
+  int next_arg;
+  try {
+    if (std::filesystem::is_directory(argv[1])) {
+      cubes = DS::read_split_directory<literal_type>(argv[1], instance);
+      split_result = DS::read_split_result(argv[1]);
+      if (split_result == "SATISFIABLE") cubes.clear();
+      next_arg = 2;
+    }
+    else {
+      if (argc == 2) {
+        std::cerr << err << "The split-file is missing.\n";
+        return errcode_parameter;
+      }
+      instance = argv[1];
+      cubes = DS::read_split_file<literal_type>(argv[2]);
+      next_arg = 3;
+    }
+  }
+  catch (const DS::SplitReadingError& e) {
+    std::cerr << err << e.what() << "\n";
+    return errcode_split;
+  }
+
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc > next_arg + 1) {
+    std::cerr << err << "Too many arguments.\n";
+    return errcode_parameter;
+  }
+  if (argc == next_arg + 1) {
+    const std::string t = argv[next_arg];
+    try {
+      std::size_t pos;
+      const unsigned long n = std::stoul(t, &pos);
+      if (pos != t.size() or n == 0 or n > 1024) throw std::out_of_range(t);
+      threads = n;
+    }
+    catch (const std::exception&) {
+      std::cerr << err << "Invalid number of threads \"" << t << "\".\n";
+      return errcode_parameter;
+    }
+  }
+
+  DS::BaseFormula<literal_type> F;
+  {std::ifstream in(instance);
+   if (not in) {
+     std::cerr << err << "Can not open instance " << instance << ".\n";
+     return errcode_instance;
+   }
+   try {
+     OKlib::InputOutput::StandardDIMACSInput<DS::BaseFormula<literal_type>, OKlib::InputOutput::LiteralReadingStrict, literal_type>(in, F);
+   }
+   catch (const std::exception& e) {
+     std::cerr << err << "Reading error with instance " << instance << ":\n"
+       << e.what() << "\n";
+     return errcode_instance;
+   }
+  }
+  for (const auto& c : cubes)
+    for (const literal_type x : c.lits)
+      if (x > F.n_ or x < -F.n_) {
+        std::cerr << err << "Variable in cube " << c.F <<
+          " is greater than n = " << F.n_ << ".\n";
+        return errcode_split;
+      }
+
+  const DS::Summary S = DS::conquer<TawSolverCore>(F, cubes, threads, std::cout);
+
+  const Result_value res = S.sat != 0 or split_result == "SATISFIABLE" ? sat :
+    S.conquered == cubes.size() and S.unknown == 0 ? unsat : unknown;
+  std::cout << "# result " << (res == sat ? "SATISFIABLE" : res == unsat ?
+      "UNSATISFIABLE" : "UNKNOWN") << "\n"
+    "# cubes " << cubes.size() << "\n"
+    "# conquered " << S.conquered << "\n"
+    "# sat_cubes " << S.sat << "\n"
+    "# unknown_cubes " << S.unknown << "\n"
+    "# refuted_by_ucp " << S.refuted_ucp << "\n";
+  if (not split_result.empty())
+    std::cout << "# splitting_result " << split_result << "\n";
+  std::cout <<
+    "# wall_time(sec) " << std::setprecision(3) << S.time.count() << "\n"
+    "# threads " << threads << "\n"
+    "# instance " << instance.string() << "\n"
+    "# backend " << TawSolverCore::name << "\n"
+    "# program " << program_name << " " << conquer_version << "\n";
+  return res;
+}
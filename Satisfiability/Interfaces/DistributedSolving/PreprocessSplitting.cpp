@@ -44,6 +44,7 @@ License, or any later version. */
 #include <cassert>
 #include <algorithm>
 #include <stdexcept>
+#include <limits>
 
 #include <cstdint>
 
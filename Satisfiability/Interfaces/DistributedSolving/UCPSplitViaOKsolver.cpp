@@ -0,0 +1,136 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file Interfaces/DistributedSolving/UCPSplitViaOKsolver.cpp
+  \brief Application for computing the unit-clause propagation for the
+  decisions of a splitting
+
+  Usage:
+
+    UCPSplitViaOKsolver SplitViaOKsolver_dir [threads]
+
+  uses the directory created by SplittingViaOKsolver (the cubes in
+  Instances/1, ..., with their decisions in Instances/decisions, for the
+  instance given by file F), while
+
+    UCPSplitViaOKsolver instance.cnf split_file [threads]
+
+  uses the cubes as created by the OKsolver with options "-S=split_file -SF"
+  for instance.cnf (with the decisions in split_file_decisions).
+  The default for threads is the number of hardware threads.
+
+  The base-instance is read once, and for each cube the number of variables
+  assigned by unit-clause propagation of its decisions, and of the whole
+  cube, is computed (see ucp_cubes in Conquer.hpp). To standard output the
+  table with these numbers is output (in the order of the cubes), followed
+  by a summary in lines starting with "#" (so that the output can be read
+  by read.table in R).
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <filesystem>
+#include <thread>
+#include <chrono>
+#include <iomanip>
+#include <exception>
+
+#include <OKlib/Satisfiability/Interfaces/InputOutput/Dimacs.hpp>
+#include <OKlib/Satisfiability/Interfaces/DistributedSolving/Conquer.hpp>
+
+namespace {
+
+  enum {
+    errcode_parameter = 1,
+    errcode_split = 2,
+    errcode_instance = 3
+  };
+
+  const std::string program = "UCPSplitViaOKsolver";
+  const std::string err = "ERROR[" + program + "]: ";
+
+  const std::string version = "0.1.0";
+
+  namespace DS = OKlib::Satisfiability::Interfaces::DistributedSolving;
+  typedef int literal_type;
+
+  // The number of cubes read at once:
+  constexpr std::size_t batch = 1 << 14;
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (argc < 2 or argc > 4) {
+    std::cerr << err << "Usage:\n  " << program <<
+      " SplitViaOKsolver_dir [threads]\n  " << program <<
+      " instance.cnf split_file [threads]\n";
+    return errcode_parameter;
+  }
+  const bool dir_mode = std::filesystem::is_directory(argv[1]);
+  if (not dir_mode and argc == 2) {
+    std::cerr << err << "The split-file is missing.\n";
+    return errcode_parameter;
+  }
+  const int next_arg = dir_mode ? 2 : 3;
+  if (argc > next_arg + 1) {
+    std::cerr << err << "Too many arguments.\n";
+    return errcode_parameter;
+  }
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc == next_arg + 1) {
+    const std::string t = argv[next_arg];
+    try {
+      std::size_t pos;
+      const unsigned long n = std::stoul(t, &pos);
+      if (pos != t.size() or n == 0 or n > 1024) throw std::out_of_range(t);
+      threads = n;
+    }
+    catch (const std::exception&) {
+      std::cerr << err << "Invalid number of threads \"" << t << "\".\n";
+      return errcode_parameter;
+    }
+  }
+
+  const auto t0 = std::chrono::steady_clock::now();
+  try {
+    DS::SplitStream<literal_type> S(dir_mode ? argv[1] : argv[2]);
+    const std::filesystem::path instance = dir_mode ? S.instance() :
+      std::filesystem::path(argv[1]);
+
+    DS::BaseFormula<literal_type> F;
+    {std::ifstream in(instance);
+     if (not in) {
+       std::cerr << err << "Can not open instance " << instance << ".\n";
+       return errcode_instance;
+     }
+     try {
+       OKlib::InputOutput::StandardDIMACSInput<DS::BaseFormula<literal_type>, OKlib::InputOutput::LiteralReadingStrict, literal_type>(in, F);
+     }
+     catch (const std::exception& e) {
+       std::cerr << err << "Reading error with instance " << instance <<
+         ":\n" << e.what() << "\n";
+       return errcode_instance;
+     }
+    }
+
+    const DS::count_type N = DS::ucp_cubes(F, S, threads, batch, std::cout);
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - t0;
+    std::cout << "# cubes " << N << "\n"
+      "# wall_time(sec) " << std::setprecision(3) << t.count() << "\n"
+      "# threads " << threads << "\n"
+      "# instance " << instance.string() << "\n"
+      "# program " << program << " " << version << "\n";
+  }
+  catch (const DS::SplitReadingError& e) {
+    std::cout.flush();
+    std::cerr << err << e.what() << "\n";
+    return errcode_split;
+  }
+}
@@ -0,0 +1 @@
+Sat_003_dir 1
\ No newline at end of file
@@ -0,0 +1 @@
+Sat_004_dir 1
\ No newline at end of file
@@ -0,0 +1 @@
+Unsat_001.cnf Unsat_001_split 1
\ No newline at end of file
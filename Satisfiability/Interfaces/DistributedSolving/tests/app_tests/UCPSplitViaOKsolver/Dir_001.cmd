@@ -0,0 +1 @@
+Unsat_dir 1
\ No newline at end of file
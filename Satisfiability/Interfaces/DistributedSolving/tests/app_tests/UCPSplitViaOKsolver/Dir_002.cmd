@@ -0,0 +1 @@
+Unsat_dir 3
\ No newline at end of file
@@ -0,0 +1 @@
+Sat_001.cnf Sat_001_split 3
\ No newline at end of file
@@ -365,6 +365,7 @@ namespace OKlib {
             typedef typename boost::range_const_iterator<Range>::type range_iterator;
             const range_iterator bc = boost::const_begin(clause);
             if (s == 1) {
+              units.push_back(*bc);
               push_unit_clause(*bc);
               return;
             }
@@ -410,6 +411,21 @@ namespace OKlib {
           //! needs to take care of contradicting_uclause()
           void set_assignments(const assignment_type& fnew) { f = fnew; }
 
+          /*!
+            \brief resets the assignment to the unit-clauses of the input,
+            so that further unit-clauses can be pushed and perform_ucp()
+            can be run again
+
+            The clauses (and their watched literals) are kept, so that this
+            takes time linear in the size of the previous assignment.
+          */
+          void reset() {
+            f.clear();
+            contradicting_ucl = contradiction_ucp = false;
+            add_com.str("");
+            for (const literal_type x : units) push_unit_clause(x);
+          }
+
 
           //! output to cls-adaptor (adding a comment in case a contradiction was found)
           template <class CLSAdaptor>
@@ -562,6 +578,8 @@ namespace OKlib {
           bclause_set_type F2;
           //! FW[index(x)] is the list of watched clauses (in F) for literal x
           wclause_set_type FW;
+          //! the unit-clauses from the input
+          bclause_list_type units;
           assignment_type f;
           int_type num_var;
           int_type num_cl, num_2cl, num_ge3cl;
@@ -1078,8 +1078,9 @@ namespace Lookahead {
 
   public:
     Node(const TreeOutput::treeoutput_t log = nullptr,
-         const TreeOutput::TreeOutputO outlvl = TreeOutput::TreeOutputO::none) :
-      ndid(1), prntid(0), dpth(0), out(log, outlvl) { assert(valid()); }
+         const TreeOutput::TreeOutputO outlvl = TreeOutput::TreeOutputO::none,
+         TreeOutput::BinaryWriter* const blog = nullptr) :
+      ndid(1), prntid(0), dpth(0), out(log, outlvl, blog) { assert(valid()); }
 
     count_t depth() const noexcept { assert(valid()); return dpth; }
     count_t id() const noexcept { assert(valid()); return ndid; }
@@ -1091,9 +1092,16 @@ namespace Lookahead {
       assert(valid());
     }
     void increment_depth() noexcept { ++dpth; assert(valid()); }
+    bool logging() const noexcept { return out.active(); }
+    // No record is built without tree-output:
     void update_log(const count_t ndid, const int branchvar,
-      const values_t values) noexcept {
-      out.add(ndid, dpth, branchvar, values);
+      const values_t& values, const float_t ltau = FP::pinfinity,
+      const BrStatus status = BrStatus::branching) {
+      if (not out.active()) return;
+      TreeOutput::NodeRecord r;
+      r.id = ndid; r.parent = prntid; r.depth = dpth; r.var = branchvar;
+      r.status = TreeOutput::status_t(status); r.ltau = ltau; r.values = values;
+      out.add(r);
       assert(valid());
     }
 
@@ -1196,7 +1204,7 @@ namespace Lookahead {
       // Log node data. Here the number of nodes is not yet updated, so it
       // corresponds to the current node id:
       const count_t nodeid = stat->nodes();
-      m->update_log(nodeid, var, values);
+      m->update_log(nodeid, var, values, br.ltau, br.status);
       return new BranchingChoice<MinDomValue>(*this, br, stat);
     }
 
@@ -1562,6 +1570,9 @@ namespace Lookahead {
       assert(not x[var].assigned() or best_br.status() == BrStatus::unsat);
       const Timing::Time_point t1 = timing();
       stat->increment_choice(t1-t0);
+      if (best_br.status() != BrStatus::unsat)
+        m->update_log(stat->nodes(), best_br.var, best_br.values,
+                      best_br.ltau, best_br.status());
       return new ValBranchingChoice<LookaheadValue>(*this, best_br, stat);
     }
 
@@ -1671,6 +1682,9 @@ namespace Lookahead {
       const Timing::Time_point t1 = timing();
       stat->increment_choice(t1-t0);
       const count_t nodeid = m->id();
+      if (best_br.status() != BrStatus::unsat and m->logging())
+        m->update_log(stat->nodes(), best_br.var, {best_br.value},
+                      best_br.ltau, best_br.status());
       return new EqBranchingChoice<LookaheadEq>(*this, best_br, nodeid, stat);
     }
 
@@ -1792,6 +1806,9 @@ namespace Lookahead {
              or best_br.status_val() == BrStatus::unsat);
       const Timing::Time_point t1 = timing();
       stat->increment_choice(t1-t0);
+      if (best_br.status != BrStatus::unsat)
+        m->update_log(stat->nodes(), best_br.var, best_br.values,
+                      best_br.ltau, best_br.status);
       return new BranchingChoice<LookaheadEqVal>(*this, best_br, stat);
     }
 
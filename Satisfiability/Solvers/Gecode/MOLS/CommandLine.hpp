@@ -31,6 +31,7 @@ License, or any later version. */
 #include "Parsing.hpp"
 #include "PartialSquares.hpp"
 #include "Options.hpp"
+#include "Portfolio.hpp"
 
 namespace CommandLine {
 
@@ -39,6 +40,7 @@ namespace CommandLine {
   namespace PR = Parsing;
   namespace PS = PartialSquares;
   namespace OP = Options;
+  namespace PF = Portfolio;
 
   typedef CD::size_t size_t;
 
@@ -171,6 +173,76 @@ namespace CommandLine {
     if (x.empty()) return 1;
     else return FloatingPoint::to_float64(x);
   }
+  // Reading either "t" or "s,t", where s is the number of runs in parallel
+  // (default 1), and t as for read_threads:
+  std::pair<unsigned, double>
+  read_scan_threads([[maybe_unused]]const int argc,
+                    const char* const argv[], const int pos) {
+    assert(argc >= pos+1);
+    const std::string x = argv[pos];
+    const auto items = Environment::split(x, ',');
+    if (items.size() <= 1)
+      return {1, x.empty() ? 1 : FloatingPoint::to_float64(x)};
+    if (items.size() != 2) {
+      std::ostringstream ss;
+      ss << "ERROR[CommandLine::read_scan_threads]: The threads-argument \""
+         << x << "\" has more than two items.\n";
+      throw std::runtime_error(ss.str());
+    }
+    const FloatingPoint::UInt_t s = items[0].empty() ? 1 :
+      FloatingPoint::to_UInt(items[0]);
+    if (s == 0 or s > 4096) {
+      std::ostringstream ss;
+      ss << "ERROR[CommandLine::read_scan_threads]: The number of runs in"
+        " parallel must be in 1..4096, but is " << s << ".\n";
+      throw std::runtime_error(ss.str());
+    }
+    return {unsigned(s),
+            items[1].empty() ? 1 : FloatingPoint::to_float64(items[1])};
+  }
+
+  // Reading the optional comma-separated portfolio-options "timeout=T"
+  // (T in seconds) and "race" at position pos (if present):
+  PF::PortfolioO read_portfolio(const int argc, const char* const argv[],
+                                const int pos, const unsigned scan) {
+    PF::PortfolioO res; res.scan = scan;
+    if (argc <= pos) return res;
+    for (const std::string& item : Environment::split(argv[pos], ',')) {
+      if (item.empty()) continue;
+      if (item == "race") res.race = true;
+      else if (item.starts_with("timeout=")) {
+        res.timeout = FloatingPoint::to_float64(item.substr(8));
+        if (not (res.timeout >= 0)) {
+          std::ostringstream ss;
+          ss << "ERROR[CommandLine::read_portfolio]: The timeout must be"
+            " non-negative, but is \"" << item.substr(8) << "\".\n";
+          throw std::runtime_error(ss.str());
+        }
+      }
+      else {
+        std::ostringstream ss;
+        ss << "ERROR[CommandLine::read_portfolio]: Portfolio-item \"" <<
+          item << "\" invalid.\n";
+        throw std::runtime_error(ss.str());
+      }
+    }
+    return res;
+  }
+
+
+  // Reading the optional "clonesize" at position pos (false if absent or
+  // empty):
+  bool read_clonesize(const int argc, const char* const argv[],
+                      const int pos) {
+    if (argc <= pos) return false;
+    const std::string s = argv[pos];
+    if (s.empty()) return false;
+    if (s == "clonesize") return true;
+    std::ostringstream ss;
+    ss << "ERROR[CommandLine::read_clonesize]: The last argument must be"
+      " empty or \"clonesize\", but is \"" << s << "\".\n";
+    throw std::runtime_error(ss.str());
+  }
 
 
   std::string output_filename(const std::string& stem, const size_t N) {
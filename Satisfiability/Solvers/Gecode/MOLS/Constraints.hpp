@@ -13,6 +13,8 @@ License, or any later version. */
 #ifndef CONSTRAINTS_hBa0Xe3nKA
 #define CONSTRAINTS_hBa0Xe3nKA
 
+#include <memory>
+
 #include <gecode/int.hh>
 #include <gecode/search.hh>
 
@@ -24,6 +26,7 @@ namespace Constraints {
   namespace GC = Gecode;
   namespace EC = Encoding;
   namespace LAB = LookaheadBranching;
+  namespace LR = LookaheadReduction;
 
   typedef EC::size_t size_t;
 
@@ -50,14 +53,23 @@ namespace Constraints {
     typedef GC::IntVar Var;
     VarVec V;
     LAB::vec_t wghts;
-    LookaheadMols(LookaheadMols& gm) : LAB::Node(gm), V(gm.V), wghts(gm.wghts) {
+    // The threads for the look-ahead probes (shared by all copies), or null
+    // (only the calling thread):
+    std::shared_ptr<LR::ProbePool> pl;
+    // The cache of the probes (shared by all copies, since the entries are
+    // tagged with the domain-state), or null:
+    std::shared_ptr<LR::ProbeCache> cch;
+    LookaheadMols(LookaheadMols& gm) : LAB::Node(gm), V(gm.V), wghts(gm.wghts),
+                                       pl(gm.pl), cch(gm.cch) {
       V.update(*this, gm.V);
       assert(valid());
     }
     GC::Space* copy() { return new LookaheadMols(*this); }
   public :
-    LookaheadMols(const EC::EncCond& enc, const LAB::vec_t wghts_) :
-      wghts(wghts_) {
+    LookaheadMols(const EC::EncCond& enc, const LAB::vec_t wghts_,
+                  std::shared_ptr<LR::ProbePool> pool = {},
+                  std::shared_ptr<LR::ProbeCache> cache = {}) :
+      wghts(wghts_), pl(std::move(pool)), cch(std::move(cache)) {
       assert(wghts.size() == enc.N-1);
       V = enc.post<VarVec, Var>(this);
       assert(valid());
@@ -72,6 +84,9 @@ namespace Constraints {
     }
     GC::IntVarArray var() const noexcept { assert(valid()); return V; }
     LAB::vec_t weights() const noexcept { assert(valid()); return wghts; }
+    unsigned threads() const noexcept { return pl ? pl->threads() : 1; }
+    LR::ProbePool* pool() const noexcept { return pl.get(); }
+    LR::ProbeCache* cache() const noexcept { return cch.get(); }
   };
 
 }
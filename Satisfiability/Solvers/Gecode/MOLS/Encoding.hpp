@@ -10,6 +10,12 @@ License, or any later version. */
 
   Contains the class EncCond for providing encoding-services.
 
+  With member sprop ("special propagators", for PropO::spec), the
+  product-equations are posted via the propagators from Propagators.hpp
+  (for N <= Propagators::maxN), together with orthogonality (only by
+  forward checking), where this follows from the ls-conditions (see
+  ortho_rprod, ortho_cprod).
+
 */
 
 /*
@@ -163,6 +169,7 @@ Indeed quite obvious that
 
 #include "Conditions.hpp"
 #include "PartialSquares.hpp"
+#include "Propagators.hpp"
 
 namespace Encoding {
 
@@ -181,6 +188,7 @@ namespace Encoding {
     const size_t N2;
     const size_t num_vars;
     const GC::IntPropLevel pl;
+    const bool sprop;
 
     static bool valid(const size_t N) noexcept {
       return N >= 2 and N <= 10000;
@@ -188,9 +196,10 @@ namespace Encoding {
 
     EncCond(const CD::AConditions& ac,
             const PS::PSquares& ps,
-            const GC::IntPropLevel pl = {}) noexcept
+            const GC::IntPropLevel pl = {},
+            const bool sprop = false) noexcept
       : ac(ac), ps(ps), N(ps.N), N2(N*N), num_vars(ac.num_squares() * N2),
-        pl(pl) {
+        pl(pl), sprop(sprop and N <= Propagators::maxN) {
       assert(valid(N));
       assert(PS::valid(ps, ac));
     }
@@ -398,10 +407,23 @@ namespace Encoding {
             equal(s, va[index(e.lhs(),i,j)], va[index(e.rhs(),i,j)]);
       }
     }
+    bool has_ls(const CD::UC uc, const Square s) const noexcept {
+      return ac.sqs(CD::UC::ls).sqs().contains(s) or
+        ac.sqs(uc).sqs().contains(s);
+    }
+    // For A = B C: the cells of C and A yield different pairs:
+    bool ortho_rprod(const Square B, const Square C) const noexcept {
+      return has_ls(CD::UC::cls, B) and has_ls(CD::UC::rls, C);
+    }
+    bool ortho_cprod(const Square B, const Square C) const noexcept {
+      return has_ls(CD::UC::rls, B) and has_ls(CD::UC::cls, C);
+    }
+
     template <class VAR, class VA, typename SP>
     void post_prod_equations(const VA& va, const SP s) const {
       assert(s);
       typedef std::vector<VAR> vv_t;
+      if (sprop) { post_prod_equations_sprop<VAR>(va, s); return; }
       for (const CD::ProdEq& p : ac.peq()) {
         const Square A = p.r(), B = p.f2(), C = p.f1(); // A = B C
         if (p.pt() == CD::PT::rprod) {
@@ -425,6 +447,39 @@ namespace Encoding {
         }
       }
     }
+    template <class VAR, class VA, typename SP>
+    void post_prod_equations_sprop(const VA& va, const SP s) const {
+      assert(s and sprop);
+      typedef std::vector<VAR> vv_t;
+      for (const CD::ProdEq& p : ac.peq()) {
+        const Square A = p.r(), B = p.f2(), C = p.f1(); // A = B C
+        const bool rprod = p.pt() == CD::PT::rprod;
+        // Line l: row l for rprod, column l for cprod:
+        const auto ind = [this,rprod](const Square S, const size_t l,
+                                      const size_t m) {
+          return rprod ? index(S,l,m) : index(S,m,l);
+        };
+        for (size_t l = 0; l < N; ++l) {
+          vv_t a, b, c; a.reserve(N); b.reserve(N); c.reserve(N);
+          for (size_t m = 0; m < N; ++m) {
+            a.push_back(va[ind(A,l,m)]);
+            b.push_back(va[ind(B,l,m)]);
+            c.push_back(va[ind(C,l,m)]);
+          }
+          Propagators::prod_row(*s, GC::IntVarArgs(a), GC::IntVarArgs(b),
+                                GC::IntVarArgs(c));
+        }
+        if (rprod ? ortho_rprod(B,C) : ortho_cprod(B,C)) {
+          vv_t x, y; x.reserve(N2); y.reserve(N2);
+          for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j) {
+              x.push_back(va[index(C,i,j)]); y.push_back(va[index(A,i,j)]);
+            }
+          Propagators::orthogonal_fc(*s, GC::IntVarArgs(x),
+                                     GC::IntVarArgs(y), N);
+        }
+      }
+    }
 
 
     // The VA is default-constructed in the calling-class, and updated
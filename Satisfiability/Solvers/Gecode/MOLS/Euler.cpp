@@ -71,6 +71,8 @@ BUGS:
 #include <tuple>
 #include <iomanip>
 #include <memory>
+#include <fstream>
+#include <sstream>
 
 #include <cstdlib>
 
@@ -88,8 +90,8 @@ BUGS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.17.2",
-        "22.3.2022",
+        "0.18.0",
+        "17.10.2026",
         __FILE__,
         "Noah Rubin, Curtis Bright, Oliver Kullmann, and Oleg Zaikin",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/2mols.cpp",
@@ -129,6 +131,9 @@ namespace {
     " [N lines of numbers and *, ignore spaces for LS1]\n" <<
     " [N lines of numbers and *, ignore spaces for LS2]\n" <<
     "EOL-symbols between blocks are ignored.\n\n" <<
+    "With binout the search-tree is written in binary format to file\n" <<
+    "TREE_" << proginfo.prg << "_N_timestamp (see TreeOutput.hpp;" <<
+    " convert via TreeLog2Text).\n\n" <<
     "For given N, k, and k partially filled Latin squares, solves the\n" <<
     "Euler square completion problem.\n\n";
     return true;
@@ -201,9 +206,23 @@ int main(const int argc, const char* const argv[]) {
   Statistics::SearchStat stat;
   std::ostream treeout(NULL);
   const TreeOutput::TreeOutputO to = std::get<TreeOutput::TreeOutputO>(alg_options);
+  std::unique_ptr<std::ofstream> btreeout;
+  std::unique_ptr<TreeOutput::BinaryWriter> btreewriter;
+  if (to == TreeOutput::TreeOutputO::binary) {
+    std::ostringstream ss;
+    ss << "TREE_" << proginfo.prg << "_" << N << "_"
+       << Environment::CurrentTime::timestamp_uint();
+    btreeout = std::make_unique<std::ofstream>(ss.str(), std::ios::binary);
+    if (not *btreeout) {
+      std::cerr << error << "Can not open file \"" << ss.str() << "\" for"
+        " writing.\n";
+      return 1;
+    }
+    btreewriter = std::make_unique<TreeOutput::BinaryWriter>(btreeout.get());
+  }
   const std::unique_ptr<TwoMOLS> p(new TwoMOLS(N, alg_options,
                         gecode_options, ls1_partial, ls2_partial,
-                        &wghts, &stat, &treeout, to));
+                        &wghts, &stat, &treeout, to, btreewriter.get()));
   assert(p->valid());
   // Post branching:
   LA::post_branching<TwoMOLS>(p, alg_options);
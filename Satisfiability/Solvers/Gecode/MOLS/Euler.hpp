@@ -299,8 +299,9 @@ namespace Euler {
             const LA::weights_t wghts = nullptr,
             const LA::statistics_t stat = nullptr,
             const TreeOutput::treeoutput_t out = nullptr,
-            const TreeOutput::TreeOutputO outlvl = TreeOutput::TreeOutputO::full) :
-      Node(out, outlvl), N(N), alg_options(alg_options),
+            const TreeOutput::TreeOutputO outlvl = TreeOutput::TreeOutputO::full,
+            TreeOutput::BinaryWriter* const bout = nullptr) :
+      Node(out, outlvl, bout), N(N), alg_options(alg_options),
       gecode_options(gecode_options), wghts(wghts), stat(stat),
       x(*this, N*N, 0, N - 1),
       y(*this, N*N, 0, N - 1),
@@ -29,6 +29,13 @@ TODOS:
    - Maintain node id and parent node id.
    - Check correctness of node id and parent node id.
 
+5. DONE (using LR::for_each_probe with the LR::ProbePool of the node)
+   The probes of BinLookahead are evaluated in parallel.
+
+6. DONE (using LR::ProbeCache)
+   The probes var==val of BinLookahead are taken from the cache (filled by
+   the reduction for the same domain-state).
+
 */
 
 #ifndef LOOKAHEADBRANCHING_wXJWMxXz3R
@@ -81,15 +88,15 @@ namespace LookaheadBranching {
     return size;
   }
 
-  // lookahead-distance.
-  inline float_t distance(const GC::IntVarArray& V, const GC::IntVarArray& Vn,
+  // lookahead-distance, given the domain-sizes:
+  inline float_t distance(const LR::sizes_t& S, const LR::sizes_t& Sn,
                           const vec_t wghts, const count_t depth) noexcept {
     assert(not wghts.empty());
+    assert(S.size() == Sn.size());
     float_t s = 0;
-    const int N = V.size();
-    for (int i = 0; i < N; ++i) {
-      const auto ds = tr(V[i].size(), 1);
-      const auto dsn = tr(Vn[i].size(), 1);
+    for (std::size_t i = 0; i < S.size(); ++i) {
+      const auto ds = tr(S[i], 1);
+      const auto dsn = tr(Sn[i], 1);
       if (dsn == ds) continue;
       assert(dsn < ds);
       if (dsn == 1) { // smaller domain has size 1, take depth into account:
@@ -102,6 +109,12 @@ namespace LookaheadBranching {
     }
     return s;
   }
+  // The same, for the variables:
+  inline float_t distance(const GC::IntVarArray& V, const GC::IntVarArray& Vn,
+                          const vec_t wghts, const count_t depth) {
+    assert(V.size() == Vn.size());
+    return distance(LR::domain_sizes(V), LR::domain_sizes(Vn), wghts, depth);
+  }
 
   template<class CustomBranching>
   CustomBranching best_branching(
@@ -311,7 +324,8 @@ namespace LookaheadBranching {
     virtual GC::Choice* choice(GC::Space& home) noexcept {
       ModSpace* m = &(static_cast<ModSpace&>(home));
       assert(m->status() == GC::SS_BRANCH);
-      LR::ReduceRes res = LR::reduction_sat_eager<ModSpace>(home, x, start);
+      LR::ReduceRes res =
+        LR::reduction_sat_eager<ModSpace>(home, x, start, m->pool());
       // Update the start (first unassigned) variable:
       for (auto i = start; i < x.size(); ++i)
         if (not x[i].assigned()) { start = i; break;}
@@ -336,27 +350,50 @@ namespace LookaheadBranching {
         std::vector<BinBranching> tau_brs;
         const vec_t wghts = m->weights();
         const count_t dpth = m->depth();
-        // Find all branchings:
+        // All pairs (var,val), with the distances for var==val, var!=val:
+        struct probe_t { int var, val; float_t dist1, dist2; bool cached; };
+        std::vector<probe_t> probes;
         for (int var = start; var < x.size(); ++var) {
           const IntView view = x[var];
           if (view.assigned()) continue;
           assert(view.size() >= 2);
-          for (IntVarValues j(view); j(); ++j) {
-            const int val = j.val();
-            const auto subm_eq = LR::subproblem<ModSpace>(m, var, val, true);
-            [[maybe_unused]] const auto subm_eq_st = subm_eq->status();
-            assert(subm_eq_st == GC::SS_BRANCH);
-            const float_t dist1 = distance(m->var(), subm_eq->var(), wghts, dpth);
-            assert(dist1 > 0);
-            const auto subm_neq = LR::subproblem<ModSpace>(m, var, val, false);
+          for (IntVarValues j(view); j(); ++j)
+            probes.push_back({var, j.val(), 0, 0, false});
+        }
+        // The distances for var==val from the cache:
+        if (LR::ProbeCache* const cache = m->cache()) {
+          const LR::state_t st = cache->state(x);
+          const LR::sizes_t S = LR::domain_sizes(x);
+          for (probe_t& p : probes) {
+            const LR::probe_res_t* const r = cache->find(p.var, p.val, st);
+            if (r and r->st == GC::SS_BRANCH) {
+              p.dist1 = distance(S, r->sizes, wghts, dpth);
+              p.cached = true;
+            }
+          }
+        }
+        // Evaluated in parallel, measuring w.r.t. the copy base of m:
+        LR::for_each_probe(m, probes.size(), m->pool(),
+          [&probes, &wghts, dpth](ModSpace* const base, const std::size_t i) {
+            probe_t& p = probes[i];
+            if (not p.cached) {
+              const auto subm_eq = LR::subproblem<ModSpace>(base, p.var, p.val, true);
+              [[maybe_unused]] const auto subm_eq_st = subm_eq->status();
+              assert(subm_eq_st == GC::SS_BRANCH);
+              p.dist1 = distance(base->var(), subm_eq->var(), wghts, dpth);
+            }
+            assert(p.dist1 > 0);
+            const auto subm_neq = LR::subproblem<ModSpace>(base, p.var, p.val, false);
             [[maybe_unused]] const auto subm_neq_st = subm_neq->status();
             assert(subm_neq_st == GC::SS_BRANCH);
-            const float_t dist2 = distance(m->var(), subm_neq->var(), wghts, dpth);
-            assert(dist2 > 0);
-            BinBranching br(var, val, {true,false}, {dist1,dist2});
-            assert(br.status() == BrStatus::branching);
-            tau_brs.push_back(br);
-          }
+            p.dist2 = distance(base->var(), subm_neq->var(), wghts, dpth);
+            assert(p.dist2 > 0);
+          });
+        // Find all branchings (in the order of the variables and values):
+        for (const probe_t& p : probes) {
+          BinBranching br(p.var, p.val, {true,false}, {p.dist1,p.dist2});
+          assert(br.status() == BrStatus::branching);
+          tau_brs.push_back(br);
         }
         assert(not tau_brs.empty());
         // Choose the best branchibg:
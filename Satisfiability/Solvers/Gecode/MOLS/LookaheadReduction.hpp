@@ -38,6 +38,38 @@ TODOS:
     - reduction_enum_eager - eager and super-eager enumerative reduction.
     - reduction_enum_lazy - lazy enumerative reduction.
 
+5. DONE (for_each_probe, ProbePool)
+   Parallel evaluation of the probes:
+    - A Gecode-space can not be cloned by several threads at the same time
+      (cloning temporarily modifies the original space).
+    - So each worker-thread gets its own copy of the node-space, and clones
+      the subproblems from that copy.
+    - The results are stored per probe, and then processed in the order of
+      the sequential evaluation, so that the search-tree is the same for
+      every number of threads.
+    - The worker-threads are persistent (ProbePool, one per search), so that
+      no threads are created per node.
+    - reduction_sat_eager evaluates the probes in windows (of probe_window
+      probes per thread), so that after a reduction at most one window of
+      probes is outdated.
+
+6. DONE (ProbeCache)
+   Caching the outcomes of the probes var==val:
+    - The key is (var, val, s), where s is the domain-state of all
+      variables (with its hash-value); so an entry is valid in every space
+      of the search.
+    - The data is the status of the subproblem, and (if undecided) its
+      domain-sizes (as needed for the distance-computation).
+    - The last round of reduction_sat_eager and the branching-probes of
+      BinLookahead are for the same domain-state, and so all probes var==val
+      of the branching are found in the cache.
+    - Keys are compared by the domain-states themselves, not only by their
+      hash-values, so that hash-collisions can not yield wrong outcomes
+      (which could prune values with solutions); the domain-states are
+      shared by the entries (ProbeCache::state), so that usually only
+      pointers are compared.
+    - Also the probes var!=val could be cached.
+
 */
 
 #ifndef LOOKAHEADREDUCTION_fJ5peeEDiH
@@ -45,7 +77,18 @@ TODOS:
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <algorithm>
+#include <cmath>
 
+#include <cstdint>
 #include <cassert>
 
 
@@ -65,6 +108,10 @@ namespace LookaheadReduction {
   typedef GC::IntVarValues IntVarValues;
 
   typedef std::vector<int> values_t;
+  // The domain-sizes of the variables:
+  typedef std::vector<int> sizes_t;
+  typedef std::uint64_t hash_t;
+  typedef std::uint64_t count_t;
 
   enum class BranchingStatus { unsat=0, sat=1, single=2, branching=3 };
 
@@ -87,6 +134,219 @@ namespace LookaheadReduction {
     return c;
   }
 
+  // The number of threads for the probes, according to the semantics of the
+  // threads-option of Gecode (Section 9.3 of MPG.pdf), with m the number of
+  // cores: t >= 1 yields t, t <= -1 yields m+t, 0 < t < 1 yields t*m,
+  // -1 < t < 0 yields (1+t)*m, and t = 0 yields m (always at least 1):
+  inline unsigned probe_threads(const double t) noexcept {
+    const double m = std::max(1u, std::thread::hardware_concurrency());
+    double res;
+    if (t >= 1) res = t;
+    else if (t <= -1) res = m + t;
+    else if (t > 0) res = t * m;
+    else if (t < 0) res = (1 + t) * m;
+    else res = m;
+    return unsigned(std::min(std::max(1.0, std::floor(res)), 4096.0));
+  }
+
+  // The persistent threads for the probes, created once per search (and
+  // shared by all copies of the node-space): threads-1 worker-threads wait
+  // for the next job, while the calling thread is the remaining thread.
+  // run(f) calls f(w) for all 0 <= w < threads(), where w = 0 is the
+  // calling thread, and returns when all these calls are completed; run is
+  // not reentrant, and must be called by one thread at a time:
+  class ProbePool {
+    const unsigned t;
+    std::mutex mtx;
+    std::condition_variable cv_job, cv_done;
+    std::function<void(unsigned)> job;
+    count_t round = 0;
+    unsigned running = 0;
+    bool finished = false;
+    // Last data-member, so that the threads are joined first:
+    std::vector<std::jthread> workers;
+
+    void work(const unsigned w) {
+      for (count_t seen = 0;;) {
+        {std::unique_lock lock(mtx);
+         cv_job.wait(lock, [this, seen]{return finished or round != seen;});
+         if (finished) return;
+         seen = round;
+        }
+        job(w);
+        const std::lock_guard lock(mtx);
+        if (--running == 0) cv_done.notify_one();
+      }
+    }
+
+  public :
+    explicit ProbePool(const unsigned threads) : t(std::max(1u, threads)) {
+      workers.reserve(t-1);
+      for (unsigned w = 1; w < t; ++w)
+        workers.emplace_back([this, w]{ work(w); });
+    }
+    ProbePool(const ProbePool&) = delete;
+    ProbePool& operator =(const ProbePool&) = delete;
+    ~ProbePool() {
+      {const std::lock_guard lock(mtx); finished = true;}
+      cv_job.notify_all();
+    }
+
+    unsigned threads() const noexcept { return t; }
+
+    template <class FUN>
+    void run(const FUN& f) {
+      if (t == 1) { f(0u); return; }
+      {const std::lock_guard lock(mtx);
+       job = [&f](const unsigned w){ f(w); };
+       running = t-1; ++round;
+      }
+      cv_job.notify_all();
+      // The workers use f until they are finished:
+      std::exception_ptr e;
+      try { f(0u); }
+      catch (...) { e = std::current_exception(); }
+      {std::unique_lock lock(mtx);
+       cv_done.wait(lock, [this]{return running == 0;});
+      }
+      if (e) std::rethrow_exception(e);
+    }
+  };
+
+  // Call f(base, i) for 0 <= i < n, by at most pool->threads() many threads
+  // (only by the calling thread if pool is null), where base is m for the
+  // calling thread, and a copy of m (owned by the thread) otherwise; f must
+  // clone only from base, and write only to its own results for i:
+  template <class ModSpace, class FUN>
+  void for_each_probe(ModSpace* const m, const std::size_t n,
+                      ProbePool* const pool, const FUN& f) {
+    assert(m->status() == GC::SS_BRANCH);
+    const std::size_t t =
+      pool ? std::min(std::size_t(pool->threads()), n) : 1;
+    if (t <= 1) {
+      for (std::size_t i = 0; i < n; ++i) f(m, i);
+      return;
+    }
+    std::vector<std::unique_ptr<ModSpace>> copies;
+    copies.reserve(t-1);
+    for (std::size_t i = 1; i < t; ++i)
+      copies.emplace_back(static_cast<ModSpace*>(m->clone()));
+    std::atomic<std::size_t> next{0};
+    pool->run([m, n, t, &copies, &next, &f](const unsigned w) {
+      if (w >= t) return;
+      ModSpace* const base = w == 0 ? m : copies[w-1].get();
+      for (std::size_t i;
+           (i = next.fetch_add(1, std::memory_order_relaxed)) < n;)
+        f(base, i);
+    });
+  }
+
+  // The domain-sizes for an array of variables or views:
+  template <class VA>
+  sizes_t domain_sizes(const VA& V) {
+    sizes_t res; res.reserve(V.size());
+    for (int i = 0; i < V.size(); ++i) res.push_back(V[i].size());
+    return res;
+  }
+
+  // The domains of an array of views (for each view the number of its
+  // ranges, followed by their bounds), with the hash-value:
+  typedef std::vector<int> domains_t;
+  struct state_t {
+    hash_t h = 0;
+    std::shared_ptr<const domains_t> d;
+    // Equality of the domains (not just of the hash-values):
+    bool operator ==(const state_t& s) const noexcept {
+      return h == s.h and (d == s.d or (d and s.d and *d == *s.d));
+    }
+  };
+  inline state_t domain_state(const IntViewArray& x) {
+    hash_t h = 0xcbf29ce484222325ULL;
+    const auto combine = [&h](const hash_t v) noexcept {
+      h ^= v + 0x9e3779b97f4a7c15ULL + (h << 12) + (h >> 4);
+    };
+    domains_t D;
+    for (int i = 0; i < x.size(); ++i) {
+      const std::size_t num = D.size();
+      D.push_back(0);
+      for (GC::Int::ViewRanges<IntView> r(x[i]); r(); ++r) {
+        ++D[num]; D.push_back(r.min()); D.push_back(r.max());
+        combine(hash_t(std::uint32_t(r.min())) << 32 |
+                std::uint32_t(r.max()));
+      }
+      combine(hash_t(i));
+    }
+    return {h, std::make_shared<const domains_t>(std::move(D))};
+  }
+
+  struct cache_stats_t {
+    count_t lookups = 0, hits = 0;
+    bool operator ==(const cache_stats_t&) const noexcept = default;
+  };
+  // The outcome of a probe var==val:
+  struct probe_res_t {
+    GC::SpaceStatus st;
+    sizes_t sizes; // empty if st is not GC::SS_BRANCH
+  };
+
+  // The cache of the outcomes of probes var==val in domain-state st (not
+  // thread-safe; the probes themselves are evaluated in parallel, while
+  // lookup and insertion happen only in the calling thread); when reaching
+  // the capacity, all entries are removed:
+  class ProbeCache {
+    struct key_t {
+      int var, val; state_t st;
+      bool operator ==(const key_t&) const noexcept = default;
+    };
+    struct key_hash {
+      std::size_t operator()(const key_t& k) const noexcept {
+        return k.st.h ^ ((hash_t(std::uint32_t(k.var)) << 32 |
+                          std::uint32_t(k.val)) * 0x9e3779b97f4a7c15ULL);
+      }
+    };
+    std::unordered_map<key_t, probe_res_t, key_hash> M;
+    // The domains of the states in M, by hash-value:
+    std::unordered_multimap<hash_t, std::shared_ptr<const domains_t>> D;
+    const std::size_t cap;
+    cache_stats_t s;
+    void clear() noexcept { M.clear(); D.clear(); }
+  public :
+    static constexpr std::size_t default_capacity = 1 << 16;
+    explicit ProbeCache(const std::size_t capacity = default_capacity) :
+      cap(capacity) { assert(cap >= 1); }
+
+    // The domain-state of x, sharing the domains with an equal state of the
+    // cache (so that keys are mostly compared by pointers):
+    state_t state(const IntViewArray& x) {
+      state_t st = domain_state(x);
+      const auto [b, e] = D.equal_range(st.h);
+      for (auto i = b; i != e; ++i)
+        if (*i->second == *st.d) { st.d = i->second; return st; }
+      if (D.size() >= cap) clear();
+      D.emplace(st.h, st.d);
+      return st;
+    }
+
+    // The returned pointer is valid until the next insertion:
+    const probe_res_t* find(const int var, const int val,
+                            const state_t& st) noexcept {
+      ++s.lookups;
+      const auto f = M.find({var,val,st});
+      if (f == M.end()) return nullptr;
+      ++s.hits;
+      return &f->second;
+    }
+    void insert(const int var, const int val, const state_t& st,
+                probe_res_t r) {
+      if (M.size() >= cap) clear();
+      M.insert_or_assign({var,val,st}, std::move(r));
+    }
+
+    std::size_t size() const noexcept { return M.size(); }
+    std::size_t capacity() const noexcept { return cap; }
+    cache_stats_t stats() const noexcept { return s; }
+  };
+
   // Result of lookahead-reduction:
   struct ReduceRes {
     BranchingStatus st;
@@ -123,74 +383,136 @@ namespace LookaheadReduction {
   //  3) the backtracking tree is reduced in such a way, that no single-child
   //     branching occurs, so everything is ready for calling a
   //     lookahead-branching.
+  //
+  // With a pool of threads > 1, the probes are evaluated in parallel (see
+  // for_each_probe), w.r.t. the current state of home, for windows of the
+  // next unassigned variables with at least probe_window*threads probes;
+  // after a reduction of home the rest of the window is outdated, and the
+  // next window starts after the reduced variable (so the result is as for
+  // threads = 1, while per reduction at most one window is evaluated in
+  // vain).
+  // If m->cache() is not null, then the outcomes of the probes are taken
+  // from and stored in the cache.
+  constexpr std::size_t probe_window = 4;
   template<class ModSpace>
   ReduceRes reduction_sat_eager(GC::Space& home, const IntViewArray x,
-                                const int start) {
+                                const int start,
+                                ProbePool* const pool = nullptr) {
     assert(start < x.size());
     ModSpace* m = &(static_cast<ModSpace&>(home));
     assert(m->status() == GC::SS_BRANCH);
+    const std::size_t window =
+      pool and pool->threads() > 1 ? probe_window * pool->threads() : 1;
+    ProbeCache* const cache = m->cache();
+    // The probes var==val with their results:
+    struct probe_t {
+      int var, val; GC::SpaceStatus st; sizes_t sizes; bool cached;
+    };
+    std::vector<probe_t> probes;
+    // The indices of the probes to be evaluated:
+    std::vector<std::size_t> open;
+    state_t st; bool changed_home = true;
     bool reduction = false;
     do {
       reduction = false;
-      // Iterate over all unassigned variables:
-      for (int var = start; var < x.size(); ++var) {
-        const IntView view = x[var];
-        if (view.assigned()) continue;
-        assert(view.size() >= 2);
-        values_t values;
-        // All such val that var!=val:</font>
-        values_t noteqvalues;
-
-        // Iterate over all values of the current variable:
-        for (IntVarValues j(view); j(); ++j) {
-          const int val = j.val();
-          assert(m->status() == GC::SS_BRANCH);
-          // Make a copy of the current problem, and assign var==val:
-          const auto subm = subproblem<ModSpace>(m, var, val, true);
-          // Call Gecode propagation:
-          const auto status = subm->status();
-          // If a solution if found, return it immediately:
-          if (status == GC::SS_SOLVED) {
-            return ReduceRes(BranchingStatus::sat, var, {val});
+      int begin = start;
+      while (begin < x.size()) {
+        // The probes for the unassigned variables from begin on, until the
+        // window is filled (for threads = 1 only for the first of them):
+        probes.clear();
+        int end = begin;
+        for (; end < x.size() and probes.size() < window; ++end) {
+          const IntView view = x[end];
+          if (view.assigned()) continue;
+          assert(view.size() >= 2);
+          for (IntVarValues j(view); j(); ++j)
+            probes.push_back({end, j.val(), GC::SS_BRANCH, {}, false});
+        }
+        open.clear();
+        if (cache) {
+          if (changed_home) { st = cache->state(x); changed_home = false; }
+          for (std::size_t i = 0; i < probes.size(); ++i) {
+            probe_t& p = probes[i];
+            if (const probe_res_t* const r = cache->find(p.var, p.val, st)) {
+              p.st = r->st; p.cached = true;
+            }
+            else open.push_back(i);
           }
-          // If the assignment var==val is inconsistent, then var!=val:
-          else if (status == GC::SS_FAILED) noteqvalues.push_back(val);
-          // The assignment var==val is relatively inconsistent,
-          // i.e. it is not clear whether it is inconsistent or not:
-          else values.push_back(val);
         }
+        else
+          for (std::size_t i = 0; i < probes.size(); ++i) open.push_back(i);
+        // Make a copy of the current problem, assign var==val, and call
+        // Gecode propagation:
+        for_each_probe(m, open.size(), pool,
+          [&probes, &open, cache](ModSpace* const base, const std::size_t i) {
+            probe_t& p = probes[open[i]];
+            const auto subm = subproblem<ModSpace>(base, p.var, p.val, true);
+            p.st = subm->status();
+            if (cache and p.st == GC::SS_BRANCH)
+              p.sizes = domain_sizes(subm->var());
+          });
+        if (cache)
+          for (const std::size_t i : open) {
+            probe_t& p = probes[i];
+            cache->insert(p.var, p.val, st, {p.st, std::move(p.sizes)});
+          }
+        begin = end;
 
-        // No branches, so the problem is unsatisfiable:
-        if (values.empty()) {
-          return ReduceRes(BranchingStatus::unsat);
-        }
-        // If single-child branching:
-        else if (values.size() == 1) {
-          reduction = true;
-          GC::rel(home, x[var], GC::IRT_EQ, values[0], GC::IPL_DOM);
-          const auto status = home.status();
-          if (status == GC::SS_FAILED) return ReduceRes(BranchingStatus::unsat);
-          else if (status == GC::SS_SOLVED) return ReduceRes(BranchingStatus::sat, var, values);
-        }
-        // None from above - non-sat, non-unsat, at least 2 branches.
-        // Apply all var!=val assignments in one batch:
-       if (not noteqvalues.empty()) {
-          reduction = true;
-          for (auto& noteqval : noteqvalues) {
-            GC::rel(home, x[var], GC::IRT_NQ, noteqval, GC::IPL_DOM);
+        // Processing the variables in the given order, until home is changed:
+        for (auto p = probes.cbegin(); p != probes.cend();) {
+          const int var = p->var;
+          values_t values;
+          // All such val that var!=val:
+          values_t noteqvalues;
+          for (; p != probes.cend() and p->var == var; ++p) {
+            // If a solution if found, return it immediately:
+            if (p->st == GC::SS_SOLVED) {
+              return ReduceRes(BranchingStatus::sat, var, {p->val});
+            }
+            // If the assignment var==val is inconsistent, then var!=val:
+            else if (p->st == GC::SS_FAILED) noteqvalues.push_back(p->val);
+            // The assignment var==val is relatively inconsistent,
+            // i.e. it is not clear whether it is inconsistent or not:
+            else values.push_back(p->val);
           }
-          // Call a propagation:
-          const auto status = home.status();
-          // Check if the problem is solved:
-          if (status == GC::SS_FAILED) {
+
+          bool changed = false;
+          // No branches, so the problem is unsatisfiable:
+          if (values.empty()) {
             return ReduceRes(BranchingStatus::unsat);
           }
-          else if (status == GC::SS_SOLVED) {
-            assert(not values.empty());
-            return ReduceRes(BranchingStatus::sat, var, {values[0]});
+          // If single-child branching:
+          else if (values.size() == 1) {
+            changed = true;
+            GC::rel(home, x[var], GC::IRT_EQ, values[0], GC::IPL_DOM);
+            const auto status = home.status();
+            if (status == GC::SS_FAILED) return ReduceRes(BranchingStatus::unsat);
+            else if (status == GC::SS_SOLVED) return ReduceRes(BranchingStatus::sat, var, values);
+          }
+          // None from above - non-sat, non-unsat, at least 2 branches.
+          // Apply all var!=val assignments in one batch:
+          if (not noteqvalues.empty()) {
+            changed = true;
+            for (auto& noteqval : noteqvalues) {
+              GC::rel(home, x[var], GC::IRT_NQ, noteqval, GC::IPL_DOM);
+            }
+            // Call a propagation:
+            const auto status = home.status();
+            // Check if the problem is solved:
+            if (status == GC::SS_FAILED) {
+              return ReduceRes(BranchingStatus::unsat);
+            }
+            else if (status == GC::SS_SOLVED) {
+              assert(not values.empty());
+              return ReduceRes(BranchingStatus::sat, var, {values[0]});
+            }
+          }
+          // The remaining probes are outdated:
+          if (changed) {
+            reduction = true; changed_home = true; begin = var + 1; break;
           }
         }
-      } // for (int var = start; var < x.size(); ++var) {
+      } // while (begin < x.size())
     } while (reduction);
 
     return ReduceRes(BranchingStatus::branching);
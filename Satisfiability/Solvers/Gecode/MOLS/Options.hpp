@@ -41,15 +41,20 @@ namespace Options {
     sat_decision = 1,
     count_solutions = 2,
     count_with_log = 3,
-    enumerate_solutions = 4
+    enumerate_solutions = 4,
+    enumerate_classes = 5, // representatives of isotopy-classes, see Symmetry.hpp
+    enumerate_classes_t = 6 // the same, also w.r.t. transposition
   };
-  constexpr int RTsize = int(RT::enumerate_solutions) + 1;
+  constexpr int RTsize = int(RT::enumerate_classes_t) + 1;
   constexpr bool valid(const RT rt) noexcept {
     return int(rt) < RTsize;
   }
   constexpr bool with_log(const RT rt) noexcept {
     return rt == RT::count_with_log;
   }
+  constexpr bool enum_classes(const RT rt) noexcept {
+    return rt == RT::enumerate_classes or rt == RT::enumerate_classes_t;
+  }
 
 
   // Propagation levels for Gecode-constraints:
@@ -57,9 +62,11 @@ namespace Options {
     dom=0, // domain propagation (strongest)
     def=1, // default propagation (different for different constraints)
     val=2, // values propagation (weakest)
-    bnd=3 // bounds propagation
+    bnd=3, // bounds propagation
+    spec=4 // domain propagation, with special propagators (Propagators.hpp;
+           // orthogonality only by forward checking)
   };
-  constexpr int PropOsize = int(PropO::bnd) + 1;
+  constexpr int PropOsize = int(PropO::spec) + 1;
   GC::IntPropLevel prop_level(const PropO po) noexcept {
     switch (po) {
     case PropO::dom: return GC::IPL_DOM;
@@ -68,6 +75,9 @@ namespace Options {
     case PropO::bnd: return GC::IPL_BND;
     default : return GC::IPL_DOM;}
   }
+  constexpr bool special_prop(const PropO po) noexcept {
+    return po == PropO::spec;
+  }
 
   // Variable-selection for Gecode-branching ("branching-heuristic variables").
   // According to Section 8.5.1 of 'Modeling and Programming with Gecode.
@@ -154,17 +164,20 @@ namespace Environment {
   template <> struct RegistrationPolicies<Options::RT> {
     static constexpr int size = Options::RTsize;
     static constexpr std::array<const char*, size>
-      string {"sats", "satd", "count", "+count", "enum"};
+      string {"sats", "satd", "count", "+count", "enum", "enumc",
+        "enumct"};
     static constexpr std::array<const char*, size>
       estring {"sat-solving", "sat-decision", "count-solutions",
-        "count-sols-with-log", "enumerate-solutions"};
+        "count-sols-with-log", "enumerate-solutions", "enumerate-classes",
+        "enumerate-classes-t"};
   };
   template <> struct RegistrationPolicies<Options::PropO> {
     static constexpr int size = Options::PropOsize;
     static constexpr std::array<const char*, size>
-      string {"dom", "def", "val", "bnd"};
+      string {"dom", "def", "val", "bnd", "spec"};
     static constexpr std::array<const char*, size>
-      estring {"domain-prop", "default-prop", "values-prop", "bounds-prop"};
+      estring {"domain-prop", "default-prop", "values-prop", "bounds-prop",
+        "special-prop"};
   };
   template <> struct RegistrationPolicies<Options::BHV> {
     static constexpr int size = Options::BHVsize;
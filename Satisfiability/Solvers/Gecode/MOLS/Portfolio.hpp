@@ -0,0 +1,176 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Running the combinations of algorithmic options in parallel ("scanning")
+
+   - struct PortfolioO: the number of runs in parallel, the timeout per run,
+     and whether the first completed run stops the other runs ("race";
+     which run wins depends on the timing, so the results are not
+     deterministic)
+   - enum class RunStatus (completed, timeout, cancelled)
+   - class RunStop, a Gecode-stop-object for timeout and cancellation
+   - function-template run_portfolio(n, po, solve, output).
+
+  The results are output in the order of the runs (not in the order of
+  completion); with po.scan > 1, the main thread only does the output.
+
+TODOS:
+
+1. Sharing the encoding between the runs
+    - Currently for every propagation-level a new EncCond is created in
+      the main thread, and the runs only read it.
+
+*/
+
+#ifndef PORTFOLIO_r7TqVd2kLw
+#define PORTFOLIO_r7TqVd2kLw
+
+#include <vector>
+#include <optional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <ostream>
+#include <algorithm>
+
+#include <cassert>
+
+#include <gecode/search.hh>
+
+namespace Portfolio {
+
+  namespace GC = Gecode;
+
+  struct PortfolioO {
+    unsigned scan = 1; // number of runs in parallel
+    double timeout = 0; // wall-clock-time in seconds per run (0 means none)
+    bool race = false; // the first completed run cancels the other runs
+    bool active() const noexcept { return scan > 1 or timeout > 0 or race; }
+    bool operator ==(const PortfolioO&) const noexcept = default;
+  };
+  inline std::ostream& operator <<(std::ostream& out, const PortfolioO& po) {
+    return out << "scan=" << po.scan << " timeout=" << po.timeout <<
+      " race=" << po.race;
+  }
+
+  enum class RunStatus { completed = 0, timeout = 1, cancelled = 2 };
+  inline std::ostream& operator <<(std::ostream& out, const RunStatus s) {
+    switch (s) {
+    case RunStatus::completed : return out << "done";
+    case RunStatus::timeout : return out << "timeout";
+    default : return out << "cancelled";}
+  }
+
+  // Stopping the search once the deadline is reached, or cancel is set
+  // (stop() may be called by several threads of the Gecode-search):
+  class RunStop : public GC::Search::Stop {
+    typedef std::chrono::steady_clock clock_t;
+    const bool with_deadline;
+    const clock_t::time_point deadline;
+    const std::atomic<bool>* const cancel;
+    std::atomic<RunStatus> st{RunStatus::completed};
+  public :
+    RunStop(const double timeout, const std::atomic<bool>* const cancel)
+      noexcept :
+      with_deadline(timeout > 0),
+      deadline(clock_t::now() +
+               std::chrono::duration_cast<clock_t::duration>(
+                 std::chrono::duration<double>(std::max(timeout,0.0)))),
+      cancel(cancel) {}
+
+    bool stop(const GC::Search::Statistics&,
+              const GC::Search::Options&) override {
+      if (cancel and cancel->load(std::memory_order_relaxed)) {
+        st = RunStatus::cancelled; return true;
+      }
+      if (with_deadline and clock_t::now() >= deadline) {
+        st = RunStatus::timeout; return true;
+      }
+      return false;
+    }
+    RunStatus status() const noexcept { return st; }
+  };
+
+  // The outcome of a run besides its result:
+  struct RunInfo {
+    RunStatus status;
+    double wt; // wall-clock-time in seconds
+  };
+
+  /* Calling solve(i, stop) -> RES for 0 <= i < n, by po.scan many threads,
+     and output(i, res, info) in the order of i; with po.race, the first
+     completed run (not stopped by timeout or cancellation) cancels the
+     remaining runs (race is for sat-decision and sat-solving, where every
+     completed run decides the problem).
+     The results of solve are not changed: with po.scan > 1 the user-times
+     measured by the solvers are for the whole process (including the other
+     runs), and then the wall-clock-times info.wt are to be used.
+     Returns the index of the first completed run with po.race (in the order
+     of completion), or n if there is none (or po.race is false).
+  */
+  template <class RES, class SOLVE, class OUT>
+  std::size_t run_portfolio(const std::size_t n, const PortfolioO& po,
+                            const SOLVE& solve, const OUT& output) {
+    assert(po.scan >= 1);
+    typedef std::chrono::steady_clock clock_t;
+    std::atomic<bool> cancel{false};
+    std::atomic<std::size_t> first_winner{n};
+    const auto single_run = [&](const std::size_t i) {
+      RunStop stop(po.timeout, po.race ? &cancel : nullptr);
+      const auto t0 = clock_t::now();
+      RES res = solve(i, &stop);
+      const std::chrono::duration<double> wt = clock_t::now() - t0;
+      const RunStatus status = stop.status();
+      if (po.race and status == RunStatus::completed) {
+        std::size_t none = n;
+        first_winner.compare_exchange_strong(none, i);
+        cancel = true;
+      }
+      return std::pair<RES, RunInfo>(std::move(res), {status, wt.count()});
+    };
+
+    if (po.scan == 1 or n <= 1) {
+      for (std::size_t i = 0; i < n; ++i) {
+        const auto [res, info] = single_run(i);
+        output(i, res, info);
+      }
+      return first_winner;
+    }
+
+    std::vector<std::optional<std::pair<RES, RunInfo>>> results(n);
+    std::mutex m;
+    std::condition_variable cv;
+    std::atomic<std::size_t> next{0};
+    const auto work = [&] {
+      for (std::size_t i; (i = next.fetch_add(1)) < n;) {
+        auto r = single_run(i);
+        {std::lock_guard l(m); results[i] = std::move(r);}
+        cv.notify_one();
+      }
+    };
+    {std::vector<std::jthread> workers;
+     const std::size_t t = std::min(std::size_t(po.scan), n);
+     workers.reserve(t);
+     for (std::size_t j = 0; j < t; ++j) workers.emplace_back(work);
+     for (std::size_t i = 0; i < n; ++i) {
+       std::unique_lock l(m);
+       cv.wait(l, [&results, i]{ return results[i].has_value(); });
+       const auto [res, info] = std::move(results[i].value());
+       results[i].reset();
+       l.unlock();
+       output(i, res, info);
+     }
+    }
+    return first_winner;
+  }
+
+}
+
+#endif
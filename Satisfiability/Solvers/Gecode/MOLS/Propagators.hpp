@@ -0,0 +1,351 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Dedicated Gecode-propagators for the product-equations and orthogonality
+
+   - constant maxN: the propagators use one 64-bit word per domain
+   - function mask(x) for the domain of an int-view x as bitset
+   - class ProdRow: for arrays a, b, c of length N, the N conditions
+       a[j] = b[c[j]]
+     (one row of A = B * C for rprod, one column for cprod), with
+     domain-consistent pruning for each of these element-conditions
+   - class OrthogonalFC: for arrays x, y of length N^2 (the cells of two
+     squares), the pairs (x[p], y[p]) are pairwise different, propagated
+     by forward checking only: once the pair (v,w) is used, w is removed
+     from y at the cells with x = v, and v from x at the cells with y = w;
+     there is no pruning by counting (see Todo 1), so this is weaker than
+     domain-consistency
+      - the used pairs are kept as bitsets (copied with the space), and
+        advisors put the cells with a newly assigned value on a worklist,
+        so that only these cells, and for a newly used pair the cells with
+        one assigned value, are looked at
+   - functions prod_row(home, a, b, c) and orthogonal_fc(home, x, y, N) for
+     posting.
+
+  These propagators replace the element-constraints of
+  Encoding::EncCond::post_prod_equations for PropO::spec (see Options.hpp),
+  where orthogonal_fc is posted additionally (it is implied, but
+  element-propagation does not see it across rows).
+
+  Scope: domain-consistent pruning is only provided by ProdRow (per
+  element-condition). Orthogonality is only forward-checked (by
+  OrthogonalFC), and it is posted in addition to the ls-conditions, not
+  in place of any constraint; domain-consistent orthogonality is not
+  provided (see Todo 1).
+
+  Comparisons with the element-encoding (nodes, time, clone-size) are
+  produced by data/Benchmarks/RunPropagators (via gcMols with option
+  "clonesize"); no results are available yet.
+
+TODOS:
+
+1. Pruning for orthogonality by counting:
+    - For every value a of x, all N values of y need to remain possible
+      in the cells where x can be a (and dually).
+
+2. Larger N
+    - Using several words per domain (via Gecode's own bitsets).
+
+*/
+
+#ifndef PROPAGATORS_Hn4xW7cRqa
+#define PROPAGATORS_Hn4xW7cRqa
+
+#include <bit>
+
+#include <cstdint>
+#include <cassert>
+
+#include <gecode/int.hh>
+
+namespace Propagators {
+
+  namespace GC = Gecode;
+
+  typedef GC::Int::IntView IntView;
+  typedef GC::ViewArray<IntView> IntViewArray;
+  typedef std::uint64_t mask_t;
+  typedef unsigned size_t;
+
+  constexpr size_t maxN = 64;
+
+  inline mask_t mask(const IntView x) noexcept {
+    mask_t res = 0;
+    for (GC::Int::ViewValues<IntView> v(x); v(); ++v)
+      res |= mask_t(1) << v.val();
+    return res;
+  }
+
+  // Restricting x to m; returns false iff x becomes empty:
+  inline bool restrict(GC::Space& home, IntView x, const mask_t m,
+                       bool& changed) {
+    mask_t rem = mask(x) & ~m;
+    if (rem == 0) return true;
+    changed = true;
+    while (rem != 0) {
+      const int v = std::countr_zero(rem);
+      rem &= rem - 1;
+      if (GC::me_failed(x.nq(home, v))) return false;
+    }
+    return true;
+  }
+
+
+  class ProdRow : public GC::Propagator {
+  protected :
+    IntViewArray a, b, c;
+  public :
+    ProdRow(GC::Home home, IntViewArray a, IntViewArray b, IntViewArray c)
+      : GC::Propagator(home), a(a), b(b), c(c) {
+      a.subscribe(home, *this, GC::Int::PC_INT_DOM);
+      b.subscribe(home, *this, GC::Int::PC_INT_DOM);
+      c.subscribe(home, *this, GC::Int::PC_INT_DOM);
+    }
+    ProdRow(GC::Space& home, ProdRow& p) : GC::Propagator(home, p) {
+      a.update(home, p.a); b.update(home, p.b); c.update(home, p.c);
+    }
+
+    static GC::ExecStatus post(GC::Home home, IntViewArray a,
+                               IntViewArray b, IntViewArray c) {
+      assert(a.size() == b.size() and b.size() == c.size());
+      assert(size_t(a.size()) <= maxN);
+      (void) new (home) ProdRow(home, a, b, c);
+      return GC::ES_OK;
+    }
+
+    virtual GC::Propagator* copy(GC::Space& home) {
+      return new (home) ProdRow(home, *this);
+    }
+    virtual std::size_t dispose(GC::Space& home) {
+      a.cancel(home, *this, GC::Int::PC_INT_DOM);
+      b.cancel(home, *this, GC::Int::PC_INT_DOM);
+      c.cancel(home, *this, GC::Int::PC_INT_DOM);
+      (void) GC::Propagator::dispose(home);
+      return sizeof(*this);
+    }
+    virtual GC::PropCost cost(const GC::Space&,
+                              const GC::ModEventDelta&) const {
+      return GC::PropCost::quadratic(GC::PropCost::LO, a.size());
+    }
+    virtual void reschedule(GC::Space& home) {
+      a.reschedule(home, *this, GC::Int::PC_INT_DOM);
+      b.reschedule(home, *this, GC::Int::PC_INT_DOM);
+      c.reschedule(home, *this, GC::Int::PC_INT_DOM);
+    }
+
+    virtual GC::ExecStatus propagate(GC::Space& home,
+                                     const GC::ModEventDelta&) {
+      const size_t N = a.size();
+      mask_t B[maxN];
+      bool changed = true;
+      while (changed) {
+        changed = false;
+        for (size_t y = 0; y < N; ++y) B[y] = mask(b[y]);
+        for (size_t j = 0; j < N; ++j) {
+          const mask_t A = mask(a[j]);
+          mask_t C = mask(c[j]), suppA = 0;
+          for (mask_t r = C; r != 0; r &= r - 1) {
+            const int y = std::countr_zero(r);
+            if ((B[y] & A) == 0) C &= ~(mask_t(1) << y);
+            else suppA |= B[y];
+          }
+          if (not restrict(home, c[j], C, changed) or
+              not restrict(home, a[j], suppA, changed))
+            return GC::ES_FAILED;
+          if (c[j].assigned()) {
+            const int y = c[j].val();
+            if (not restrict(home, b[y], A & suppA, changed))
+              return GC::ES_FAILED;
+            B[y] = mask(b[y]);
+          }
+        }
+      }
+      if (a.assigned() and b.assigned() and c.assigned())
+        return home.ES_SUBSUMED(*this);
+      return GC::ES_FIX;
+    }
+  };
+
+
+  class OrthogonalFC : public GC::Propagator {
+  protected :
+    // Advisor for the view v of cell p (of x or of y):
+    class CellAdvisor : public GC::Advisor {
+    public :
+      IntView v;
+      const size_t p;
+      CellAdvisor(GC::Space& home, GC::Propagator& prop,
+                  GC::Council<CellAdvisor>& c, const IntView v0,
+                  const size_t p)
+        : GC::Advisor(home, prop, c), v(v0), p(p) {
+        v.subscribe(home, *this);
+      }
+      CellAdvisor(GC::Space& home, CellAdvisor& a)
+        : GC::Advisor(home, a), p(a.p) {
+        v.update(home, a.v);
+      }
+      void dispose(GC::Space& home, GC::Council<CellAdvisor>& c) {
+        v.cancel(home, *this);
+        GC::Advisor::dispose(home, c);
+      }
+    };
+    enum class CS : std::uint8_t { untouched=0, open=1, done=2 };
+
+    IntViewArray x, y;
+    const size_t N;
+    GC::Council<CellAdvisor> c;
+    // used[v] is the set of w with pair (v,w) used, usedt the transposition:
+    mask_t* used; mask_t* usedt;
+    // The state of the cells (done: both values assigned and accounted for):
+    CS* st;
+    // The open cells (one value assigned), possibly also done cells
+    // (removed lazily):
+    size_t* open; size_t num_open;
+    // The cells with newly assigned values (filled by the advisors):
+    size_t* todo; size_t num_todo;
+    size_t num_done;
+
+    size_t N2() const noexcept { return N*N; }
+    template <typename T>
+    static T* alloc(GC::Space& home, const size_t n) {
+      return home.alloc<T>(n);
+    }
+  public :
+    OrthogonalFC(GC::Home home, IntViewArray x0, IntViewArray y0,
+               const size_t N)
+      : GC::Propagator(home), x(x0), y(y0), N(N), c(home),
+        used(alloc<mask_t>(home, N)), usedt(alloc<mask_t>(home, N)),
+        st(alloc<CS>(home, N2())), open(alloc<size_t>(home, N2())),
+        num_open(0), todo(alloc<size_t>(home, 2*N2())), num_todo(0),
+        num_done(0) {
+      for (size_t i = 0; i < N; ++i) used[i] = usedt[i] = 0;
+      for (size_t p = 0; p < N2(); ++p) {
+        st[p] = CS::untouched;
+        if (x[p].assigned() or y[p].assigned()) todo[num_todo++] = p;
+        if (not x[p].assigned())
+          (void) new (home) CellAdvisor(home, *this, c, x[p], p);
+        if (not y[p].assigned())
+          (void) new (home) CellAdvisor(home, *this, c, y[p], p);
+      }
+      IntView::schedule(home, *this, GC::Int::ME_INT_VAL);
+    }
+    OrthogonalFC(GC::Space& home, OrthogonalFC& p)
+      : GC::Propagator(home, p), N(p.N),
+        used(alloc<mask_t>(home, N)), usedt(alloc<mask_t>(home, N)),
+        st(alloc<CS>(home, N2())), open(alloc<size_t>(home, N2())),
+        num_open(p.num_open), todo(alloc<size_t>(home, 2*N2())),
+        num_todo(p.num_todo), num_done(p.num_done) {
+      x.update(home, p.x); y.update(home, p.y);
+      c.update(home, p.c);
+      for (size_t i = 0; i < N; ++i) {
+        used[i] = p.used[i]; usedt[i] = p.usedt[i];
+      }
+      for (size_t i = 0; i < N2(); ++i) st[i] = p.st[i];
+      for (size_t i = 0; i < num_open; ++i) open[i] = p.open[i];
+      for (size_t i = 0; i < num_todo; ++i) todo[i] = p.todo[i];
+    }
+
+    static GC::ExecStatus post(GC::Home home, IntViewArray x,
+                               IntViewArray y, const size_t N) {
+      assert(N <= maxN);
+      assert(size_t(x.size()) == N*N and size_t(y.size()) == N*N);
+      (void) new (home) OrthogonalFC(home, x, y, N);
+      return GC::ES_OK;
+    }
+
+    virtual GC::Propagator* copy(GC::Space& home) {
+      return new (home) OrthogonalFC(home, *this);
+    }
+    virtual std::size_t dispose(GC::Space& home) {
+      c.dispose(home);
+      home.free<mask_t>(used, N); home.free<mask_t>(usedt, N);
+      home.free<CS>(st, N2()); home.free<size_t>(open, N2());
+      home.free<size_t>(todo, 2*N2());
+      (void) GC::Propagator::dispose(home);
+      return sizeof(*this);
+    }
+    virtual GC::PropCost cost(const GC::Space&,
+                              const GC::ModEventDelta&) const {
+      return GC::PropCost::linear(GC::PropCost::LO, x.size());
+    }
+    virtual void reschedule(GC::Space& home) {
+      IntView::schedule(home, *this, GC::Int::ME_INT_VAL);
+    }
+
+    // Every advisor reports its cell once, when its view gets assigned:
+    virtual GC::ExecStatus advise(GC::Space& home, GC::Advisor& a0,
+                                  const GC::Delta&) {
+      CellAdvisor& a = static_cast<CellAdvisor&>(a0);
+      if (not a.v.assigned()) return GC::ES_FIX;
+      assert(num_todo < 2*N2());
+      todo[num_todo++] = a.p;
+      return home.ES_NOFIX_DISPOSE(c, a);
+    }
+
+    // Forward checking: only the reported cells are processed; a newly used
+    // pair is excluded from the open cells (cells assigned by this are
+    // reported again):
+    virtual GC::ExecStatus propagate(GC::Space& home,
+                                     const GC::ModEventDelta&) {
+      bool changed = false;
+      while (num_todo != 0) {
+        const size_t p = todo[--num_todo];
+        if (st[p] == CS::done) continue;
+        if (x[p].assigned() and
+            not restrict(home, y[p], ~used[x[p].val()], changed))
+          return GC::ES_FAILED;
+        if (y[p].assigned() and
+            not restrict(home, x[p], ~usedt[y[p].val()], changed))
+          return GC::ES_FAILED;
+        if (not x[p].assigned() or not y[p].assigned()) {
+          if (st[p] == CS::untouched) {
+            st[p] = CS::open; open[num_open++] = p;
+          }
+          continue;
+        }
+        const int v = x[p].val(), w = y[p].val();
+        const mask_t bv = mask_t(1) << v, bw = mask_t(1) << w;
+        assert(not (used[v] & bw));
+        used[v] |= bw; usedt[w] |= bv;
+        st[p] = CS::done; ++num_done;
+        for (size_t i = 0; i < num_open;) {
+          const size_t q = open[i];
+          if (st[q] == CS::done) { open[i] = open[--num_open]; continue; }
+          if (x[q].assigned() and x[q].val() == v and
+              not restrict(home, y[q], ~bw, changed))
+            return GC::ES_FAILED;
+          if (y[q].assigned() and y[q].val() == w and
+              not restrict(home, x[q], ~bv, changed))
+            return GC::ES_FAILED;
+          ++i;
+        }
+      }
+      if (num_done == N2()) return home.ES_SUBSUMED(*this);
+      return GC::ES_FIX;
+    }
+  };
+
+
+  // Posting a[j] = b[c[j]] for all j:
+  inline void prod_row(GC::Home home, const GC::IntVarArgs& a,
+                       const GC::IntVarArgs& b, const GC::IntVarArgs& c) {
+    GECODE_POST;
+    const IntViewArray va(home, a), vb(home, b), vc(home, c);
+    GECODE_ES_FAIL(ProdRow::post(home, va, vb, vc));
+  }
+  // Posting the orthogonality of the N x N squares x and y (as cell-arrays):
+  inline void orthogonal_fc(GC::Home home, const GC::IntVarArgs& x,
+                         const GC::IntVarArgs& y, const size_t N) {
+    GECODE_POST;
+    const IntViewArray vx(home, x), vy(home, y);
+    GECODE_ES_FAIL(OrthogonalFC::post(home, vx, vy, N));
+  }
+
+}
+
+#endif
@@ -25,8 +25,14 @@ License, or any later version. */
   The pure Gecode-solver:
 
    - helper-function make_options
+   - function clone_size (memory of a clone of the root-space)
    - main function gcsolver_basis
    - helper function solver_gc
+   - the optional stop-object (see Portfolio.hpp) allows timeouts and
+     cancellation of the search.
+   - for RT::enumerate_classes(_t) the solutions are handed over (as
+     primary squares, via flat_primary) to the optional class-collector
+     (see Symmetry.hpp), which computes the classes in its own thread.
 
   The half look-ahead solver (only la-reduction):
 
@@ -37,6 +43,13 @@ License, or any later version. */
 
    - main function lasolver
    - helper function solver_la.
+   - the threads (one LR::ProbePool per run) are used for the look-ahead
+     probes, while the search itself is sequential (so the search-tree does
+     not depend on the threads).
+   - the outcomes of the probes are cached (see ProbeCache in
+     LookaheadReduction.hpp), with the statistics in member cs of the result
+     (the cache can be switched off via with_cache, which does not change
+     the search-tree).
 
 
 TODOS:
@@ -75,6 +88,7 @@ TODOS:
 #define SOLVERS_PNeIRm1Ic7
 
 #include <vector>
+#include <memory>
 #include <istream>
 #include <ostream>
 
@@ -92,6 +106,7 @@ TODOS:
 #include "PartialSquares.hpp"
 #include "Options.hpp"
 #include "LookaheadBranching.hpp"
+#include "Symmetry.hpp"
 
 namespace Solvers {
 
@@ -103,6 +118,8 @@ namespace Solvers {
   namespace PS = PartialSquares;
   namespace OP = Options;
   namespace LAB = LookaheadBranching;
+  namespace LR = LookaheadReduction;
+  namespace SY = Symmetry;
 
   using size_t = CD::size_t;
 
@@ -127,7 +144,7 @@ namespace Solvers {
       return sr.sol_found <= 1 and sr.list_sol.empty();
     else if (sr.rt == RT::sat_solving)
       return sr.sol_found <= 1 and sr.list_sol.size() == sr.sol_found;
-    else if (sr.rt == RT::count_solutions)
+    else if (sr.rt == RT::count_solutions or enum_classes(sr.rt))
       return sr.list_sol.empty();
     else return sr.sol_found == sr.list_sol.size();
   }
@@ -137,6 +154,8 @@ namespace Solvers {
     typedef GC::Search::Statistics gc_stats_t;
     gc_stats_t gs;
     double ut = 0;
+    // For look-ahead: lookups and hits of the cache of the probes:
+    LR::cache_stats_t cs;
     bool operator ==(const GBasicSR&) const noexcept = default;
   };
 
@@ -198,20 +217,46 @@ namespace Solvers {
     The pure Gecode-solver
   */
   // Safe creation of options for GC-search:
-  GC::Search::Options make_options(const double t) noexcept {
-    GC::Search::Options res; res.threads = t;
+  GC::Search::Options make_options(const double t,
+                                   GC::Search::Stop* const stop = nullptr)
+    noexcept {
+    GC::Search::Options res; res.threads = t; res.stop = stop;
+    return res;
+  }
+  // The memory (in bytes) of a clone of the root-space, after the initial
+  // propagation (0 if this fails):
+  std::size_t clone_size(const EC::EncCond& enc) {
+    const std::unique_ptr<CT::GenericMols0> gm(new CT::GenericMols0(enc));
+    if (gm->status() == GC::SS_FAILED) return 0;
+    const std::unique_ptr<GC::Space> c(gm->clone());
+    return c->allocated();
+  }
+  // The primary squares of a total assignment va:
+  template <class VAV>
+  SY::flat_t flat_primary(const EC::EncCond& enc, const VAV& va) {
+    assert(EC::EncCond::unit(va));
+    const size_t k = enc.ac.k, N = enc.N;
+    SY::flat_t res(k * enc.N2);
+    for (size_t s = 0, p = 0; s < k; ++s) {
+      const size_t base = enc.index(CD::Square(s));
+      for (size_t i = 0; i < enc.N2; ++i, ++p)
+        res[p] = va[base + i].val();
+    }
+    assert(SY::valid(res, N, k));
     return res;
   }
   GBasicSR gcsolver_basis(const EC::EncCond& enc, const RT rt,
                           const GC::IntVarBranch vrb,
                           const GC::IntValBranch vlb,
                           const double threads,
-                          std::ostream* const log) {
+                          std::ostream* const log,
+                          GC::Search::Stop* const stop = nullptr,
+                          SY::ClassCollector* const classes = nullptr) {
     assert(valid(rt));
     assert(not with_log(rt) or log);
     CT::GenericMols0* const gm = new CT::GenericMols0(enc);
     GC::branch(*gm, gm->V, vrb, vlb);
-    GC::DFS<CT::GenericMols0> s(gm, make_options(threads));
+    GC::DFS<CT::GenericMols0> s(gm, make_options(threads, stop));
     delete gm;
 
     GBasicSR res{rt};
@@ -251,6 +296,14 @@ namespace Solvers {
         ++res.b.sol_found; delete leaf;
       }
       res.gs = s.statistics(); break;
+    }
+    case RT::enumerate_classes:
+    case RT::enumerate_classes_t: {
+      while (CT::GenericMols0* const leaf = s.next()) {
+        if (classes) classes->push(flat_primary(enc, leaf->V));
+        ++res.b.sol_found; delete leaf;
+      }
+      res.gs = s.statistics(); break;
     }}
     return res;
   }
@@ -259,10 +312,13 @@ namespace Solvers {
                      const GC::IntVarBranch vrb,
                      const GC::IntValBranch vlb,
                      const double threads = 1,
-                     std::ostream* const log = nullptr) {
+                     std::ostream* const log = nullptr,
+                     GC::Search::Stop* const stop = nullptr,
+                     SY::ClassCollector* const classes = nullptr) {
     Timing::UserTime timing;
     const Timing::Time_point t0 = timing();
-    GBasicSR res = gcsolver_basis(enc, rt, vrb, vlb, threads, log);
+    GBasicSR res =
+      gcsolver_basis(enc, rt, vrb, vlb, threads, log, stop, classes);
     const Timing::Time_point t1 = timing();
     res.ut = t1 - t0;
     return res;
@@ -274,11 +330,18 @@ namespace Solvers {
   */
   GBasicSR lasolver(const EC::EncCond& enc, const RT rt,
                     const Options::LAT lat, const Options::BHO bord,
-                    const LAB::vec_t wghts, const double threads = 1) {
-    CT::LookaheadMols* const gm = new CT::LookaheadMols(enc, wghts);
+                    const LAB::vec_t wghts, const double threads = 1,
+                    GC::Search::Stop* const stop = nullptr,
+                    const bool with_cache = true) {
+    const auto pool =
+      std::make_shared<LR::ProbePool>(LR::probe_threads(threads));
+    const auto cache = with_cache ?
+      std::make_shared<LR::ProbeCache>() : nullptr;
+    CT::LookaheadMols* const gm =
+      new CT::LookaheadMols(enc, wghts, pool, cache);
     LAB::post_la_branching<CT::LookaheadMols>(*gm, gm->var(), lat, bord);
 
-    GC::DFS<CT::LookaheadMols> s(gm, make_options(threads));
+    GC::DFS<CT::LookaheadMols> s(gm, make_options(1, stop));
     delete gm;
 
     GBasicSR res{rt};
@@ -301,9 +364,10 @@ namespace Solvers {
       // XXX
     }
     else {
-      assert(rt == RT::enumerate_solutions);
+      assert(rt == RT::enumerate_solutions or enum_classes(rt));
       // XXX
     }
+    if (cache) res.cs = cache->stats();
     return res;
   }
 
@@ -328,10 +392,11 @@ namespace Solvers {
 
   GBasicSR solver_la(const EC::EncCond& enc, const RT rt,
                      const OP::LAT lat, const OP::BHO bord,
-                     const LAB::vec_t wghts, const double threads = 1) {
+                     const LAB::vec_t wghts, const double threads = 1,
+                     GC::Search::Stop* const stop = nullptr) {
     Timing::UserTime timing;
     const Timing::Time_point t0 = timing();
-    GBasicSR res = lasolver(enc, rt, lat, bord, wghts, threads);
+    GBasicSR res = lasolver(enc, rt, lat, bord, wghts, threads, stop);
     const Timing::Time_point t1 = timing();
     res.ut = t1 - t0;
     return res;
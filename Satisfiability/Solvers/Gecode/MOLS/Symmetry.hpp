@@ -0,0 +1,352 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Isotopy-classes of solutions (for the enumeration of representatives)
+
+   - typedef sym_t (the symbols), flat_t (k squares of order N, row-major)
+   - latin(L, N, k) checks whether the k squares are latin squares
+   - transpose(L, N, k) transposes all squares
+   - canonical(L, N, k, with_t) computes the canonical form of L under
+     the isotopies, where the row- and column-permutations are the same
+     for all squares, while every square has its own symbol-permutation;
+     with_t adds the transposition (of all squares, that is, VS::c213).
+   - to_psquares(L, N, k) converts to PSquares (with the primary squares).
+   - invariant(ac, ps, with_t) checks whether the conditions are invariant
+     under these symmetries.
+
+   - class ClassCollector computes in its own thread the canonical forms of
+     the solutions pushed, and outputs every new class-representative
+     when found; finish() returns the sizes of the classes.
+
+  The canonical form is the lexicographically smallest of all isotopic
+  versions (taking the squares one after another, each row-wise).
+  Its first row is the identity in every square, and the first column of
+  the first square is the identity; choosing the original row r0 for the
+  first row, the column a for the first column, and the original row i
+  for the second row, the second row of the first square is obtained by
+  following the cycles of the permutation between the rows r0 and i,
+  where the only choice is the start of a new cycle. For order N and c
+  cycles this yields at most N^2 (N-1) (N-1)(N-2)...(N-c+1) candidates.
+
+  The symmetries only yield classes of solutions if the conditions are
+  invariant under them: since every square has its own symbol-permutation,
+  this excludes the versions, all unary conditions besides "rls", "cls",
+  "ls" (for transposition "rls" and "cls" must apply to the same squares),
+  all (product-)equations (thus also orthogonality via auxiliary squares),
+  and the partial squares. Solutions whose primary squares are not latin
+  are not reduced (every solution forms its own class).
+
+TODOS:
+
+1. Further versions (the other conjugates, and their combinations with
+   the isotopies, that is, the main classes)
+    - Would require the conditions to be invariant under these conjugates.
+
+2. Orthogonality
+    - Handling "rprod A aux B" (and similar) would require acting on the
+      auxiliary squares by the induced maps, instead of their own
+      symbol-permutations.
+
+3. Stronger pruning
+    - Comparing the second row with the best one found so far already
+      during the cycle-following.
+
+*/
+
+#ifndef SYMMETRY_Kq3Vn8sWxe
+#define SYMMETRY_Kq3Vn8sWxe
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <ostream>
+#include <algorithm>
+#include <limits>
+
+#include <cstdint>
+#include <cassert>
+
+#include "Conditions.hpp"
+#include "PartialSquares.hpp"
+
+namespace Symmetry {
+
+  namespace CD = Conditions;
+  namespace PS = PartialSquares;
+
+  typedef CD::size_t size_t;
+  typedef std::uint8_t sym_t;
+  // The k squares, each row-wise:
+  typedef std::vector<sym_t> flat_t;
+
+  constexpr size_t maxN = std::numeric_limits<sym_t>::max();
+
+  inline bool valid(const flat_t& L, const size_t N, const size_t k) noexcept {
+    return N >= 1 and N <= maxN and L.size() == k*N*N and
+      std::ranges::all_of(L, [N](const sym_t x){return x < N;});
+  }
+
+  inline bool latin(const flat_t& L, const size_t N, const size_t k) {
+    assert(valid(L,N,k));
+    std::vector<char> seen(N);
+    for (size_t s = 0; s < k; ++s) {
+      const sym_t* const Q = L.data() + s*N*N;
+      for (size_t i = 0; i < N; ++i) {
+        std::ranges::fill(seen, false);
+        for (size_t j = 0; j < N; ++j) {
+          if (seen[Q[i*N+j]]) return false;
+          seen[Q[i*N+j]] = true;
+        }
+        std::ranges::fill(seen, false);
+        for (size_t j = 0; j < N; ++j) {
+          if (seen[Q[j*N+i]]) return false;
+          seen[Q[j*N+i]] = true;
+        }
+      }
+    }
+    return true;
+  }
+
+  inline flat_t transpose(const flat_t& L, const size_t N, const size_t k) {
+    assert(valid(L,N,k));
+    flat_t res(L.size());
+    for (size_t s = 0; s < k; ++s)
+      for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j)
+          res[s*N*N + j*N + i] = L[s*N*N + i*N + j];
+    return res;
+  }
+
+
+  namespace detail {
+
+    // The search for the canonical form of latin squares L, updating best:
+    class Canonisation {
+      const flat_t& L;
+      const size_t N, k;
+      flat_t& best;
+      typedef std::vector<size_t> perm_t;
+      static constexpr size_t undef = std::numeric_limits<size_t>::max();
+      perm_t sigma, sigma_inv; // canonical column -> column, and inverse
+      perm_t inv0; // inverse of row r0 of the first square
+      perm_t P; // the column-permutation from row r0 to row i
+      flat_t cand;
+      size_t r0 = 0, i1 = 0, a = 0;
+
+      sym_t at(const size_t s, const size_t i, const size_t j) const noexcept {
+        return L[s*N*N + i*N + j];
+      }
+
+      // All sigma completed, compute the candidate and compare:
+      void leaf() {
+        std::vector<perm_t> tau(k, perm_t(N)); // symbol-permutations
+        for (size_t s = 0; s < k; ++s)
+          for (size_t j = 0; j < N; ++j)
+            tau[s][at(s, r0, sigma[j])] = j;
+        perm_t row(N); // canonical row -> row
+        for (size_t i = 0; i < N; ++i) row[tau[0][at(0,i,a)]] = i;
+        assert(row[0] == r0 and row[1] == i1);
+        for (size_t s = 0; s < k; ++s)
+          for (size_t t = 0; t < N; ++t)
+            for (size_t j = 0; j < N; ++j)
+              cand[s*N*N + t*N + j] = tau[s][at(s, row[t], sigma[j])];
+        if (best.empty() or cand < best) best = cand;
+      }
+      // Position j of the second row, with next the smallest unused
+      // canonical column:
+      void search(const size_t j, const size_t next) {
+        if (j == N) { leaf(); return; }
+        if (sigma[j] != undef) {
+          const size_t v = P[sigma[j]];
+          if (sigma_inv[v] != undef) search(j+1, next);
+          else {
+            assert(next < N);
+            sigma[next] = v; sigma_inv[v] = next;
+            search(j+1, next+1);
+            sigma[next] = undef; sigma_inv[v] = undef;
+          }
+          return;
+        }
+        // Start of a new cycle:
+        assert(next == j);
+        for (size_t c = 0; c < N; ++c) {
+          if (sigma_inv[c] != undef) continue;
+          sigma[j] = c; sigma_inv[c] = j;
+          search(j, j+1);
+          sigma[j] = undef; sigma_inv[c] = undef;
+        }
+      }
+
+    public :
+      Canonisation(const flat_t& L, const size_t N, const size_t k,
+                   flat_t& best) :
+        L(L), N(N), k(k), best(best), sigma(N), sigma_inv(N), inv0(N), P(N),
+        cand(L.size()) {}
+
+      void operator()() {
+        for (r0 = 0; r0 < N; ++r0) {
+          for (size_t j = 0; j < N; ++j) inv0[at(0,r0,j)] = j;
+          for (i1 = 0; i1 < N; ++i1) {
+            if (i1 == r0) continue;
+            for (size_t j = 0; j < N; ++j) P[j] = inv0[at(0,i1,j)];
+            for (a = 0; a < N; ++a) {
+              std::ranges::fill(sigma, undef);
+              std::ranges::fill(sigma_inv, undef);
+              sigma[0] = a; sigma_inv[a] = 0;
+              const size_t b = P[a];
+              assert(b != a);
+              sigma[1] = b; sigma_inv[b] = 1;
+              search(1, 2);
+            }
+          }
+        }
+      }
+    };
+
+  }
+
+  // The canonical form of L (or L itself, if not latin):
+  inline flat_t canonical(const flat_t& L, const size_t N, const size_t k,
+                          const bool with_t = false) {
+    assert(valid(L,N,k));
+    if (k == 0 or N == 1 or not latin(L,N,k)) return L;
+    flat_t best;
+    detail::Canonisation(L, N, k, best)();
+    if (with_t) {
+      const flat_t T = transpose(L,N,k);
+      detail::Canonisation(T, N, k, best)();
+    }
+    return best;
+  }
+
+
+  inline PS::PSquares to_psquares(const flat_t& L, const size_t N,
+                                  const size_t k) {
+    assert(valid(L,N,k));
+    PS::PSquares::psquares_t res;
+    res.reserve(k);
+    for (size_t s = 0; s < k; ++s) {
+      PS::psquare_t Q = PS::full_psquare(N);
+      for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j)
+          Q[i][j].c[L[s*N*N + i*N + j]] = 0;
+      res.emplace_back(Q, CD::Square(s));
+    }
+    return {N, res};
+  }
+
+
+  // Whether ac, ps are invariant under the isotopies (with_t: and under
+  // transposition):
+  inline bool invariant(const CD::AConditions& ac, const PS::PSquares& ps,
+                        const bool with_t) noexcept {
+    if (not ps.psqs.empty() or not ac.eq().empty() or
+        not ac.peq().empty()) return false;
+    if (not std::ranges::all_of(ac.versions(),
+                                [](const CD::Versions& v){
+                                  return v.size() == 1;}))
+      return false;
+    for (const auto& [uc, sqs] : ac.map()) {
+      if (sqs.empty()) continue;
+      if (uc != CD::UC::rls and uc != CD::UC::cls and uc != CD::UC::ls)
+        return false;
+      if (not std::ranges::all_of(sqs.sqs(),
+                                  [](const CD::Square& s){
+                                    return s.primary();}))
+        return false;
+    }
+    return not with_t or ac.sqs(CD::UC::rls) == ac.sqs(CD::UC::cls);
+  }
+
+
+  struct flat_hash {
+    std::size_t operator()(const flat_t& L) const noexcept {
+      std::uint64_t h = 0xcbf29ce484222325ULL;
+      for (const sym_t x : L) { h ^= x; h *= 0x100000001b3ULL; }
+      return h;
+    }
+  };
+
+  /* Pushing solutions (by one thread), whose canonical forms are computed
+     by the collector-thread; every new class-representative is output
+     to out (if not null), in the order of discovery; finish() returns the
+     sizes of the classes (in the same order).
+  */
+  class ClassCollector {
+  public :
+    typedef std::vector<size_t> counts_t;
+    const size_t N, k;
+    const bool with_t;
+    static constexpr size_t default_capacity = 1 << 12;
+
+    ClassCollector(const size_t N, const size_t k, const bool with_t,
+                   std::ostream* const out,
+                   const size_t capacity = default_capacity) :
+      N(N), k(k), with_t(with_t), cap(capacity), out(out),
+      worker([this]{ run(); }) {
+      assert(N >= 1 and N <= maxN and cap >= 1);
+    }
+    ~ClassCollector() { if (worker.joinable()) finish(); }
+
+    // Blocks if the queue is full:
+    void push(flat_t L) {
+      assert(valid(L,N,k));
+      std::unique_lock l(m);
+      not_full.wait(l, [this]{ return Q.size() < cap; });
+      Q.push_back(std::move(L));
+      l.unlock();
+      not_empty.notify_one();
+    }
+
+    const counts_t& finish() {
+      {std::lock_guard l(m); closed = true;}
+      not_empty.notify_one();
+      worker.join();
+      return counts;
+    }
+
+    size_t num_classes() const noexcept { return counts.size(); }
+
+  private :
+    const size_t cap;
+    std::ostream* const out;
+    std::deque<flat_t> Q;
+    bool closed = false;
+    std::mutex m;
+    std::condition_variable not_empty, not_full;
+    std::unordered_map<flat_t, size_t, flat_hash> classes; // -> index
+    counts_t counts;
+    std::thread worker;
+
+    void run() {
+      for (;;) {
+        std::unique_lock l(m);
+        not_empty.wait(l, [this]{ return closed or not Q.empty(); });
+        if (Q.empty()) return;
+        flat_t L = std::move(Q.front()); Q.pop_front();
+        l.unlock();
+        not_full.notify_one();
+        flat_t C = canonical(L, N, k, with_t);
+        const auto [it, inserted] = classes.try_emplace(std::move(C),
+                                                         counts.size());
+        if (inserted) {
+          counts.push_back(1);
+          if (out) *out << to_psquares(it->first, N, k) << "\n";
+        }
+        else ++counts[it->second];
+      }
+    }
+  };
+
+}
+
+#endif
@@ -6,6 +6,7 @@ the Free Software Foundation and included in this library; either version 3 of t
 License, or any later version. */
 
 #include <iostream>
+#include <stdexcept>
 
 #include <cassert>
 
@@ -17,8 +18,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.0.1",
-        "27.3.2022",
+        "0.0.2",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestCommandLine.cpp",
@@ -37,5 +38,29 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv))
   return 0;
 
+  {const char* const a[] = {"", "", "3", "2,0.5", ",4", "timeout=2.5,race",
+                            "race", ""};
+   assert(eqp(read_scan_threads(8, a, 1), {1, 1}));
+   assert(eqp(read_scan_threads(8, a, 2), {1, 3}));
+   assert(eqp(read_scan_threads(8, a, 3), {2, 0.5}));
+   assert(eqp(read_scan_threads(8, a, 4), {1, 4}));
+   assert(eqp(read_portfolio(5, a, 5, 2), {2, 0, false}));
+   assert(eqp(read_portfolio(8, a, 5, 2), {2, 2.5, true}));
+   assert(eqp(read_portfolio(8, a, 6, 1), {1, 0, true}));
+   assert(eqp(read_portfolio(8, a, 7, 1), {1, 0, false}));
+   assert(not read_portfolio(8, a, 7, 1).active());
+   assert(read_portfolio(8, a, 6, 1).active());
+  }
+
+  {const char* const a[] = {"", "clonesize", "", "x"};
+   assert(not read_clonesize(1, a, 1));
+   assert(read_clonesize(2, a, 1));
+   assert(not read_clonesize(3, a, 2));
+   bool thrown = false;
+   try { read_clonesize(4, a, 3); }
+   catch (const std::runtime_error&) { thrown = true; }
+   assert(thrown);
+  }
+
 
 }
@@ -6,6 +6,8 @@ the Free Software Foundation and included in this library; either version 3 of t
 License, or any later version. */
 
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include <cassert>
 
@@ -19,8 +21,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.2",
-        "2.4.2022",
+        "0.3.3",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestEncoding.cpp",
@@ -300,4 +302,24 @@ int main(const int argc, const char* const argv[]) {
    assert(res.sol_found == FP::pow(2,2) * FP::pow(FP::factorial(4), 2));
   }
 
+  // The special propagators (Propagators.hpp) yield the same solutions:
+  {for (const std::string pt : {"rprod", "cprod"})
+     for (size_t N = 2; N <= 5; ++N) {
+       std::istringstream ss_cond("squares A B AB\nls A B AB\nred A\n"
+                                  "rred B\n" + pt + " B AB A\n");
+       const auto ac = Parsing::ReadAC()(ss_cond);
+       const PSquares ps(N, {});
+       const EncCond enc(ac, ps, Gecode::IPL_DOM),
+         encs(ac, ps, Gecode::IPL_DOM, true);
+       assert(encs.sprop and not enc.sprop);
+       assert(encs.ortho_rprod(Square(2), Square(0)) and
+              encs.ortho_cprod(Square(2), Square(0)));
+       assert(not encs.ortho_rprod(Square(2), Square(0,VS::c213)));
+       const auto res = solver0(enc, RT::enumerate_solutions),
+         ress = solver0(encs, RT::enumerate_solutions);
+       assert(res == ress);
+       assert((res.sol_found != 0) == (N != 2));
+     }
+  }
+
 }
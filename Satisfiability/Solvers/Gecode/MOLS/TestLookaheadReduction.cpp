@@ -7,6 +7,11 @@ License, or any later version. */
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include <memory>
 
 #include <cassert>
 
@@ -17,8 +22,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.0.1",
-        "27.3.2022",
+        "0.0.4",
+        "17.10.2026",
         __FILE__,
         "Oleg Zaikin and Oliver Kullmann",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestLookaheadReduction.cpp",
@@ -31,4 +36,54 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv))
   return 0;
 
+  {const unsigned m = std::max(1u, std::thread::hardware_concurrency());
+   assert(LAR::probe_threads(1) == 1);
+   assert(LAR::probe_threads(3) == 3);
+   assert(LAR::probe_threads(3.7) == 3);
+   assert(LAR::probe_threads(0) == m);
+   assert(LAR::probe_threads(-1) == std::max(1u, m-1));
+   assert(LAR::probe_threads(-1e10) == 1);
+   assert(LAR::probe_threads(0.5) == std::max(1u, m/2));
+   assert(LAR::probe_threads(1e10) == 4096);
+  }
+
+  {for (const unsigned t : {0u, 1u, 2u, 5u}) {
+     LAR::ProbePool pool(t);
+     const unsigned tt = std::max(1u, t);
+     assert(pool.threads() == tt);
+     std::vector<unsigned> calls(tt);
+     for (unsigned round = 1; round <= 100; ++round) {
+       pool.run([&calls](const unsigned w){ ++calls[w]; });
+       assert(std::ranges::all_of(calls,
+                                  [round](const unsigned c){return c == round;}));
+     }
+     bool thrown = false;
+     try { pool.run([](const unsigned w){
+                      if (w == 0) throw std::runtime_error("w=0"); }); }
+     catch (const std::runtime_error&) { thrown = true; }
+     assert(thrown);
+     pool.run([&calls](const unsigned w){ ++calls[w]; });
+     assert(std::ranges::all_of(calls, [](const unsigned c){return c == 101;}));
+   }
+  }
+
+  {// A hash-collision does not yield a wrong outcome:
+   typedef LAR::domains_t D;
+   const LAR::state_t s1{7, std::make_shared<const D>(D{1,0,2, 1,1,1})},
+     s2{7, std::make_shared<const D>(D{1,0,1, 1,1,1})},
+     s3{7, std::make_shared<const D>(D{1,0,2, 1,1,1})};
+   assert(s1 == s1);
+   assert(not (s1 == s2));
+   assert(s1 == s3);
+   assert(not (s1 == LAR::state_t{8, s1.d}));
+   LAR::ProbeCache C;
+   C.insert(0, 2, s1, {Gecode::SS_FAILED, {}});
+   assert(C.size() == 1);
+   assert(not C.find(0, 2, s2));
+   assert(not C.find(0, 1, s1));
+   const LAR::probe_res_t* const r = C.find(0, 2, s3);
+   assert(r and r->st == Gecode::SS_FAILED);
+   assert((C.stats() == LAR::cache_stats_t{3, 1}));
+  }
+
 }
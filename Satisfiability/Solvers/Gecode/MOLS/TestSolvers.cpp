@@ -7,6 +7,7 @@ License, or any later version. */
 
 #include <iostream>
 #include <sstream>
+#include <string>
 
 #include <cassert>
 
@@ -17,8 +18,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.2.1",
-        "26.3.2022",
+        "0.2.3",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestSolvers.cpp",
@@ -36,5 +37,69 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv))
   return 0;
 
+  {// The search-tree and the solution of the look-ahead solver do not
+   // depend on the number of threads for the probes:
+   const std::string euler =
+     "squares A B aux\nred A\nrred B aux\nls A B aux\nrprod A aux B\n";
+   const std::string mols3 =
+     "squares A B C AB AC BC\nls A B C AB AC BC\nred A\nrred B C\n"
+     "rprod B AB A\nrprod C AC A\nrprod C BC B\n";
+   for (const std::string& cond : {euler, mols3})
+     for (size_t N = 2; N <= 5; ++N) {
+       std::istringstream ss_cond(cond);
+       const auto ac = PR::ReadAC()(ss_cond);
+       std::istringstream ss_ps("");
+       const auto ps = PS::PSquares(N, ss_ps);
+       const EC::EncCond enc(ac, ps, GC::IPL_DOM);
+       LAB::vec_t wghts(N-1);
+       for (size_t i = 1; i < N-1; ++i) wghts[i] = i+1;
+       for (const RT rt : {RT::sat_decision, RT::sat_solving}) {
+         const auto r1 = lasolver(enc, rt, OP::LAT::bineager,
+                                  OP::BHO::binvalmin, wghts, 1);
+         const bool sat = N >= (cond == euler ? 3 : 4);
+         assert(r1.b.sol_found == sat);
+         for (const double t : {2.0, 3.0, 8.0}) {
+           const auto r = lasolver(enc, rt, OP::LAT::bineager,
+                                   OP::BHO::binvalmin, wghts, t);
+           assert(r.b == r1.b);
+           assert(r.gs.node == r1.gs.node);
+           assert(r.gs.fail == r1.gs.fail);
+           assert(r.gs.depth == r1.gs.depth);
+         }
+       }
+     }
+  }
+
+  {// The cache of the probes does not change the search-tree and the
+   // solutions:
+   const std::string euler =
+     "squares A B aux\nred A\nrred B aux\nls A B aux\nrprod A aux B\n";
+   const std::string mols3 =
+     "squares A B C AB AC BC\nls A B C AB AC BC\nred A\nrred B C\n"
+     "rprod B AB A\nrprod C AC A\nrprod C BC B\n";
+   for (const std::string& cond : {euler, mols3})
+     for (size_t N = 2; N <= 5; ++N) {
+       std::istringstream ss_cond(cond);
+       const auto ac = PR::ReadAC()(ss_cond);
+       std::istringstream ss_ps("");
+       const auto ps = PS::PSquares(N, ss_ps);
+       const EC::EncCond enc(ac, ps, GC::IPL_DOM);
+       LAB::vec_t wghts(N-1);
+       for (size_t i = 1; i < N-1; ++i) wghts[i] = i+1;
+       for (const RT rt : {RT::sat_decision, RT::sat_solving})
+         for (const OP::LAT lat : {OP::LAT::bineager, OP::LAT::enumeager}) {
+           const auto rc = lasolver(enc, rt, lat, OP::BHO::binvalmin, wghts,
+                                    1, nullptr, true);
+           const auto r0 = lasolver(enc, rt, lat, OP::BHO::binvalmin, wghts,
+                                    1, nullptr, false);
+           assert(rc.b == r0.b);
+           assert(rc.gs.node == r0.gs.node);
+           assert(rc.gs.fail == r0.gs.fail);
+           assert(rc.gs.depth == r0.gs.depth);
+           assert(eqp(r0.cs, {}));
+         }
+     }
+  }
+
 
 }
@@ -0,0 +1,179 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <set>
+#include <numeric>
+#include <algorithm>
+#include <random>
+
+#include <cassert>
+
+#include <ProgramOptions/Environment.hpp>
+
+#include "Symmetry.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.0.2",
+        "17.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestSymmetry.cpp",
+        "GPL v3"};
+
+  using namespace Symmetry;
+
+  template <class X>
+  constexpr bool eqp(const X& lhs, const X& rhs) noexcept {
+    return lhs == rhs;
+  }
+
+  // All latin squares of order N:
+  void all_ls(flat_t& L, const size_t N, const size_t p,
+              std::vector<flat_t>& res) {
+    if (p == N*N) { res.push_back(L); return; }
+    const size_t i = p / N, j = p % N;
+    for (sym_t x = 0; x < N; ++x) {
+      bool ok = true;
+      for (size_t jj = 0; jj < j; ++jj) ok = ok and L[i*N+jj] != x;
+      for (size_t ii = 0; ii < i; ++ii) ok = ok and L[ii*N+j] != x;
+      if (not ok) continue;
+      L[p] = x; all_ls(L, N, p+1, res);
+    }
+  }
+  std::vector<flat_t> all_ls(const size_t N) {
+    flat_t L(N*N); std::vector<flat_t> res; all_ls(L, N, 0, res);
+    return res;
+  }
+
+  // A random isotope (common row-/column-permutation, and symbol-permutation
+  // per square):
+  flat_t isotope(const flat_t& L, const size_t N, const size_t k,
+                 std::mt19937_64& g) {
+    std::vector<size_t> r(N), c(N);
+    std::iota(r.begin(), r.end(), 0); std::iota(c.begin(), c.end(), 0);
+    std::shuffle(r.begin(), r.end(), g); std::shuffle(c.begin(), c.end(), g);
+    flat_t res(L.size());
+    for (size_t s = 0; s < k; ++s) {
+      std::vector<sym_t> t(N);
+      std::iota(t.begin(), t.end(), 0); std::shuffle(t.begin(), t.end(), g);
+      for (size_t i = 0; i < N; ++i)
+        for (size_t j = 0; j < N; ++j)
+          res[s*N*N + r[i]*N + c[j]] = t[L[s*N*N + i*N + j]];
+    }
+    return res;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv))
+  return 0;
+
+  {assert(latin({0,1,1,0}, 2, 1));
+   assert(not latin({0,1,0,1}, 2, 1));
+   assert(eqp(transpose({0,1,0,1, 1,1,0,0}, 2, 2), {0,0,1,1, 1,0,1,0}));
+   assert(eqp(canonical({1,0,0,1}, 2, 1), {0,1,1,0}));
+   assert(eqp(canonical({0,1,0,1}, 2, 1), {0,1,0,1}));
+   assert(eqp(canonical({0}, 1, 1), {0}));
+  }
+
+  // The numbers of isotopy-classes of latin squares of orders 1,...,5
+  // (for N=5 only those with first row the identity):
+  {const std::vector<size_t> num_classes{1, 1, 1, 2, 2};
+   for (size_t N = 1; N <= 5; ++N) {
+     const auto A = all_ls(N);
+     std::set<flat_t> C;
+     for (const auto& L : A) {
+       if (N == 5 and not std::ranges::is_sorted(L.begin(), L.begin()+N))
+         continue;
+       const flat_t c = canonical(L, N, 1);
+       assert(latin(c, N, 1));
+       assert(eqp(canonical(c, N, 1), c));
+       C.insert(c);
+       if (N <= 4) assert(eqp(canonical(L, N, 1, true), canonical(c, N, 1, true)));
+     }
+     assert(C.size() == num_classes[N-1]);
+   }
+  }
+
+  // Invariance for random isotopes of a pair of MOLS of order 7:
+  {const size_t N = 7, k = 2;
+   flat_t L(k*N*N);
+   for (size_t i = 0; i < N; ++i)
+     for (size_t j = 0; j < N; ++j) {
+       L[i*N+j] = (i+j) % N; L[N*N + i*N+j] = (2*i+j) % N;
+     }
+   const flat_t c = canonical(L, N, k), ct = canonical(L, N, k, true);
+   assert(ct <= c);
+   std::mt19937_64 g(17);
+   for (unsigned r = 0; r < 20; ++r) {
+     const flat_t I = isotope(L, N, k, g);
+     assert(eqp(canonical(I, N, k), c));
+     assert(eqp(canonical(transpose(I,N,k), N, k, true), ct));
+   }
+  }
+
+  {const size_t N = 4;
+   const auto A = all_ls(N);
+   std::ostringstream out;
+   ClassCollector C(N, 1, false, &out);
+   for (const auto& L : A) C.push(L);
+   const auto counts = C.finish();
+   assert(counts.size() == 2);
+   assert(counts[0] + counts[1] == 576);
+   std::istringstream in(out.str());
+   const PS::PSquares P(N, in);
+   assert(P.psqs.size() == 2);
+  }
+
+  {using CD::UC; using CD::VS; using CD::Square;
+   std::istringstream empty("");
+   const PS::PSquares ps0(3, empty);
+   {CD::AConditions ac(2);
+    assert(invariant(ac, ps0, false));
+    assert(invariant(ac, ps0, true));
+    ac.insert(UC::ls, Square(0)); ac.insert(UC::ls, Square(1));
+    assert(invariant(ac, ps0, true));
+    ac.insert(UC::rls, Square(1));
+    assert(invariant(ac, ps0, false));
+    assert(not invariant(ac, ps0, true));
+    ac.insert(UC::cls, Square(1));
+    assert(invariant(ac, ps0, true));
+    PS::PSquares::psquares_t P;
+    P.emplace_back(PS::full_psquare(3), Square(0));
+    assert(not invariant(ac, PS::PSquares(3, P), false));
+   }
+   for (const UC uc : {UC::diag, UC::idem, UC::rred, UC::red, UC::box,
+                       UC::symm}) {
+     CD::AConditions ac(1);
+     ac.insert(uc, Square(0));
+     assert(not invariant(ac, ps0, false));
+   }
+   {CD::AConditions ac(1);
+    ac.insert(UC::ls, Square(0, VS::c213));
+    assert(not invariant(ac, ps0, false));
+   }
+   {CD::AConditions ac(1);
+    ac.insert(Square(0, VS::c231));
+    assert(not invariant(ac, ps0, false));
+   }
+   {CD::AConditions ac(2);
+    ac.insert(CD::Equation(Square(0), Square(1)));
+    assert(not invariant(ac, ps0, false));
+   }
+   {CD::AConditions ac(3);
+    ac.insert(CD::ProdEq(Square(0), Square(2), Square(1)));
+    assert(not invariant(ac, ps0, false));
+   }
+  }
+
+}
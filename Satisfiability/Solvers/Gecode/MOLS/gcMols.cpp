@@ -90,10 +90,13 @@ bnd binbr mindom asc 6240 0.050 325700 487 13453 12
     - Later considering cutoff (for restarts) and stop (terminating
       when taking too long).
 
-4. Implement an additional parallelisation-mode "scanning"
-    - In our standard way, for running the combinations in parallel.
-    - The thread-commandline-input then just becomes a pair, separated
+4. DONE (see Portfolio.hpp)
+   Implement an additional parallelisation-mode "scanning"
+    - DONE In our standard way, for running the combinations in parallel.
+    - DONE The thread-commandline-input then just becomes a pair, separated
       by comma (first the scan-threads, then the Gecode-threads).
+    - DONE (optional argument "timeout=T,race")
+      Timeout per run, and race-mode for sat-decision/solving.
     - If gecode-threads != 1, output a warning when counting or enumerating
       (that for a large number of solutions it becomes inefficient, since
       only one counting/output-instance (bottleneck)).
@@ -107,6 +110,10 @@ BUGS:
 #include <string>
 #include <ostream>
 #include <fstream>
+#include <vector>
+#include <memory>
+
+#include <cassert>
 
 #include <ProgramOptions/Environment.hpp>
 #include <Numerics/NumInOut.hpp>
@@ -117,12 +124,14 @@ BUGS:
 #include "Solvers.hpp"
 #include "Options.hpp"
 #include "CommandLine.hpp"
+#include "Portfolio.hpp"
+#include "Symmetry.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.8.3",
-        "18.4.2022",
+        "0.10.6",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann and Oleg Zaikin",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/gcMols.cpp",
@@ -130,6 +139,7 @@ namespace {
 
   const std::string error = "ERROR[" + proginfo.prg + "]: ";
   constexpr int commandline_args = 9;
+  constexpr int optional_args = 2;
 
   using namespace Conditions;
   using namespace Encoding;
@@ -137,6 +147,8 @@ namespace {
   using namespace Solvers;
   using namespace Options;
   using namespace CommandLine;
+  namespace PF = Portfolio;
+  namespace SY = Symmetry;
 
   bool show_usage(const int argc, const char* const argv[]) {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
@@ -144,7 +156,7 @@ namespace {
     std::cout <<
     "> " << proginfo.prg <<
       " N file_cond file_ps run-type prop-level branch-type branch-var branch-order"
-      " threads\n\n"
+      " threads [portfolio] [clonesize]\n\n"
       " - file_cond    : filename for conditions-specification\n"
       " - file_ps      : filename for partial-squares-specification\n"
       " - run-type     : " << Environment::WRPO<RT>{} << "\n" <<
@@ -152,13 +164,36 @@ namespace {
       " - branch-type  : " << Environment::WRPO<BRT>{} << "\n" <<
       " - branch-var   : " << Environment::WRPO<BHV>{} << "\n" <<
       " - branch-order : " << Environment::WRPO<GBO>{} << "\n" <<
-      " - threads      : floating-point for number of threads\n\n"
+      " - threads      : floating-point for number of threads, or \"s,t\"\n"
+      " - portfolio    : comma-separated \"timeout=T\" and/or \"race\"\n"
+      " - clonesize    : \"clonesize\" for the line \"# clone_size\"\n\n"
       "Here\n"
       "  - file_ps can be the empty string (no partial instantiation)\n"
       "  - the four algorithmic options can be lists (all combinations)\n"
       "  - these lists can have a leading + (inclusion) or - (exclusion)\n"
+      "  - with threads \"s,t\" the runs are performed s at a time in parallel,"
+      " each with t threads\n"
+      "  - T is the wall-clock-time in seconds per run, and with \"race\"\n"
+      "    (only for sat-decision/solving) the first completed run"
+      " cancels the others;\n    which run this is depends on the timing,"
+      " so the output (including the\n    solution in the SOLUTIONS-file)"
+      " can differ between calls\n"
+      "  - with portfolio-options the output-lines end with the run-status\n"
+      "    (" << PF::RunStatus::completed << ", " << PF::RunStatus::timeout <<
+      ", " << PF::RunStatus::cancelled << ") and the wall-clock-time of the"
+      " run\n    (with s > 1 the user-time is for the whole process)\n"
+      "  - with \"clonesize\" for each prop-level the memory in bytes of a"
+      " clone of the\n    root-space is output (after the initial"
+      " propagation)\n"
       "  - for sat-solving and enumeration, output goes to file \"" <<
-      "SOLUTIONS_" << proginfo.prg << "_N_timestamp\".\n\n"
+      "SOLUTIONS_" << proginfo.prg << "_N_timestamp\"\n"
+      "  - with enumerate-classes only the representatives of the isotopy-"
+      "classes\n    (of the primary squares) are output, with their sizes"
+      " on standard output;\n    enumerate-classes-t also identifies"
+      " transposed squares;\n    the conditions must be invariant (only"
+      " the unary conditions rls, cls, ls,\n    for enumerate-classes-t with"
+      " rls and cls for the same squares, and\n    no versions,"
+      " (product-)equations or partial squares).\n\n"
 ;
     return true;
   }
@@ -170,9 +205,11 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
   if (show_usage(argc, argv)) return 0;
 
-  if (argc !=  commandline_args + 1) {
+  if (argc < commandline_args + 1 or
+      argc > commandline_args + optional_args + 1) {
     std::cerr << error << "Exactly " << commandline_args << " command-line"
-      " arguments needed, but the real number is " << argc-1 << ".\n";
+      " arguments (plus " << optional_args << " optional) needed, but the"
+      " real number is " << argc-1 << ".\n";
     return 1;
   }
 
@@ -191,15 +228,37 @@ int main(const int argc, const char* const argv[]) {
                                         "gc-order-heuristics");
   const size_t num_runs = brtv.size()*pov.size()*bvarv.size()*gbov.size();
 
-  const double threads = read_threads(argc, argv, 9);
+  const auto scan_threads = read_scan_threads(argc, argv, 9);
+  const unsigned scan = scan_threads.first;
+  const double threads = scan_threads.second;
+  const PF::PortfolioO pfo = read_portfolio(argc, argv, 10, scan);
+  const bool with_clonesize = read_clonesize(argc, argv, 11);
+  if (pfo.race and rt != RT::sat_decision and rt != RT::sat_solving) {
+    std::cerr << error << "Race-mode only for sat-decision or sat-solving.\n";
+    return 1;
+  }
 
   const std::string outfile = output_filename(proginfo.prg, N);
 
-  const bool with_output =
-    rt == RT::sat_solving or rt == RT::enumerate_solutions;
-  if (with_output and num_runs != 1) {
-    std::cerr << error << "For solution-output the number of runs must be 1,"
-      " but is " << num_runs << ".\n";
+  const bool with_classes = enum_classes(rt);
+  if (with_classes and N > SY::maxN) {
+    std::cerr << error << "Enumeration of classes only for N <= " <<
+      SY::maxN << ".\n";
+    return 1;
+  }
+  if (with_classes and
+      not SY::invariant(ac, ps, rt == RT::enumerate_classes_t)) {
+    std::cerr << error << "Enumeration of classes only for conditions"
+      " invariant under the isotopies\n  (no versions, only rls, cls, ls,"
+      " no (product-)equations, no partial squares).\n";
+    return 1;
+  }
+  const bool with_output = rt == RT::sat_solving or
+    rt == RT::enumerate_solutions or with_classes;
+  if (with_output and num_runs != 1 and
+      not (pfo.race and rt == RT::sat_solving)) {
+    std::cerr << error << "For solution-output the number of runs must be 1"
+      " (or race-mode used), but is " << num_runs << ".\n";
     return 1;
   }
   std::ostream* const out = with_output ? new std::ofstream(outfile) : nullptr;
@@ -210,33 +269,82 @@ int main(const int argc, const char* const argv[]) {
   }
 
   const bool with_log = Options::with_log(rt);
+  if (with_log and scan != 1) {
+    std::cerr << error << "Logging only without parallel runs.\n";
+    return 1;
+  }
   std::ostream* const log = with_log ? &std::cout : nullptr;
 
   info_output(std::cout,
               N, ac, name_ac, ps, name_ps,
               rt, pov, brtv, bvarv, gbov, num_runs, threads,
               outfile, with_output);
-
+  if (pfo.active()) std::cout << "# portfolio " << pfo << std::endl;
+
+  // The runs, in the order of output:
+  struct run_t {
+    const EncCond* enc; PropO po; BRT brt; BHV bvar; GBO gbo;
+  };
+  std::vector<std::unique_ptr<const EncCond>> encs;
+  std::vector<run_t> runs; runs.reserve(num_runs);
   for (const PropO po : pov) {
-    const EncCond enc(ac, ps, prop_level(po));
+    encs.push_back(std::make_unique<const EncCond>(ac, ps, prop_level(po),
+                                                   special_prop(po)));
     for (const BRT brt : brtv)
       for (const BHV bvar : bvarv)
-        for (const GBO gbo : gbov) {
-          const BHO bord = translate(brt, gbo);
-        const GBasicSR res =
-          solver_gc(enc, rt, var_branch(bvar), val_branch(bord), threads, log);
-        using Environment::W0;
-        if (with_log) std::cout << std::endl;
-        std::cout << W0(po) << " "
-                  << W0(brt) << " " << W0(bvar) << " " << W0(gbo) << " "
-                  << res.b.sol_found << " ";
-        FloatingPoint::out_fixed_width(std::cout, 3, res.ut);
-        std::cout << " " << res.gs.propagate << " " << res.gs.fail <<
-          " " << res.gs.node << " " << res.gs.depth;
-        std::cout << std::endl;
-        if (with_output)
-          Environment::out_line(*out, res.b.list_sol, "\n");
+        for (const GBO gbo : gbov)
+          runs.push_back({encs.back().get(), po, brt, bvar, gbo});
+  }
+  assert(runs.size() == num_runs);
+  if (with_clonesize) {
+    std::cout << "# clone_size";
+    for (std::size_t i = 0; i < pov.size(); ++i)
+      std::cout << " " << Environment::W0(pov[i]) << "="
+                << clone_size(*encs[i]);
+    std::cout << std::endl;
+  }
+
+  std::unique_ptr<SY::ClassCollector> classes;
+  if (with_classes)
+    classes = std::make_unique<SY::ClassCollector>(N, ac.k,
+      rt == RT::enumerate_classes_t, out);
+
+  std::vector<listsol_t> sols(with_output ? num_runs : 0);
+  const std::size_t winner = PF::run_portfolio<GBasicSR>(num_runs, pfo,
+    [&runs, &classes, rt, threads, log](const std::size_t i,
+                                         Gecode::Search::Stop* const stop) {
+      const run_t& r = runs[i];
+      const BHO bord = translate(r.brt, r.gbo);
+      return solver_gc(*r.enc, rt, var_branch(r.bvar), val_branch(bord),
+                       threads, log, stop, classes.get());
+    },
+    [&runs, &sols, &pfo, with_log, with_output]
+    (const std::size_t i, const GBasicSR& res, const PF::RunInfo& info) {
+      const run_t& r = runs[i];
+      using Environment::W0;
+      if (with_log) std::cout << std::endl;
+      std::cout << W0(r.po) << " "
+                << W0(r.brt) << " " << W0(r.bvar) << " " << W0(r.gbo) << " "
+                << res.b.sol_found << " ";
+      FloatingPoint::out_fixed_width(std::cout, 3, res.ut);
+      std::cout << " " << res.gs.propagate << " " << res.gs.fail <<
+        " " << res.gs.node << " " << res.gs.depth;
+      if (pfo.active()) {
+        std::cout << " " << info.status << " ";
+        FloatingPoint::out_fixed_width(std::cout, 3, info.wt);
       }
+      std::cout << std::endl;
+      if (with_output) sols[i] = res.b.list_sol;
+    });
+  if (with_classes) {
+    const SY::ClassCollector::counts_t& counts = classes->finish();
+    std::cout << "# num_classes " << counts.size() << "\n# class_sizes";
+    for (const auto c : counts) std::cout << " " << c;
+    std::cout << std::endl;
+  }
+  else if (with_output) {
+    const std::size_t i = pfo.race ? winner : 0;
+    if (i < num_runs) Environment::out_line(*out, sols[i], "\n");
   }
   if (out) delete out;
 }
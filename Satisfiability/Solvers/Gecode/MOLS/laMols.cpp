@@ -83,6 +83,10 @@ The problem seems "binary-super-eager".
 #include <string>
 #include <ostream>
 #include <fstream>
+#include <vector>
+#include <memory>
+
+#include <cassert>
 
 #include <ProgramOptions/Environment.hpp>
 #include <Numerics/NumInOut.hpp>
@@ -95,12 +99,13 @@ The problem seems "binary-super-eager".
 #include "Options.hpp"
 #include "CommandLine.hpp"
 #include "LookaheadBranching.hpp"
+#include "Portfolio.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.0",
-        "17.4.2022",
+        "0.4.4",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann and Oleg Zaikin",
         "https://github.com/OKullmann/OKlib-MOLS/blob/master/Satisfiability/Solvers/Gecode/MOLS/laMols.cpp",
@@ -108,6 +113,7 @@ namespace {
 
   const std::string error = "ERROR[" + proginfo.prg + "]: ";
   constexpr int commandline_args = 9;
+  constexpr int optional_args = 1;
 
   namespace CO = Conditions;
   namespace EC = Encoding;
@@ -117,6 +123,7 @@ namespace {
   namespace CL = CommandLine;
   namespace LAB = LookaheadBranching;
   namespace FP = FloatingPoint;
+  namespace PF = Portfolio;
 
   typedef EC::size_t size_t;
 
@@ -126,7 +133,7 @@ namespace {
     std::cout <<
     "> " << proginfo.prg <<
       " N file_cond file_ps run-type prop-level la-type branchval la-weights"
-      " threads\n\n"
+      " threads [portfolio]\n\n"
       " - file_cond  : filename for conditions-specification\n"
       " - file_ps    : filename for partial-squares-specification\n"
       " - run-type   : " << Environment::WRPO<OP::RT>{} << "\n" <<
@@ -135,13 +142,33 @@ namespace {
       " - branchval  : " << Environment::WRPO<OP::BHO>{} << "\n" <<
       " - la-weights : N-1 comma-separated weigths for calculating"
       " the lookahead distance-function\n"
-      " - threads    : floating-point for number of threads\n\n"
+      " - threads    : floating-point for number of threads (for the"
+      " look-ahead probes), or \"s,t\"\n"
+      " - portfolio  : comma-separated \"timeout=T\" and/or \"race\"\n\n"
       "Here\n"
       "  - file_ps can be the empty string (no partial instantiation)\n"
       "  - the three algorithmic options can be lists (all combinations)\n"
       "  - these lists can have a leading + (inclusion) or - (exclusion)\n"
+      "  - the threads are only used for the look-ahead probes, while the"
+      " search itself\n    is sequential (so the search-tree does not depend"
+      " on them); before version\n    0.3.1 they were the threads of"
+      " Gecode's parallel search\n"
+      "  - with threads \"s,t\" the runs are performed s at a time in parallel,"
+      " each with t threads\n"
+      "  - T is the wall-clock-time in seconds per run, and with \"race\"\n"
+      "    (only for sat-decision/solving) the first completed run"
+      " cancels the others;\n    which run this is depends on the timing,"
+      " so the output (including the\n    solution in the SOLUTIONS-file)"
+      " can differ between calls\n"
       "  - for sat-solving and enumeration, output goes to file \"" <<
-      "SOLUTIONS_" << proginfo.prg << "_N_timestamp\".\n\n"
+      "SOLUTIONS_" << proginfo.prg << "_N_timestamp\".\n"
+      "  - the output-line per run ends with the number of lookups and hits\n"
+      "    of the cache of the probes (hits are saved propagations), and with\n"
+      "    portfolio-options with the run-status (" <<
+      PF::RunStatus::completed << ", " << PF::RunStatus::timeout << ", " <<
+      PF::RunStatus::cancelled << ")\n"
+      "    and the wall-clock-time of the run (with s > 1 the user-time is"
+      " for the whole process).\n\n"
 ;
     return true;
   }
@@ -153,9 +180,11 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
   if (show_usage(argc, argv)) return 0;
 
-  if (argc !=  commandline_args + 1) {
+  if (argc < commandline_args + 1 or
+      argc > commandline_args + optional_args + 1) {
     std::cerr << error << "Exactly " << commandline_args << " command-line"
-      " arguments needed, but the real number is " << argc-1 << ".\n";
+      " arguments (plus " << optional_args << " optional) needed, but the"
+      " real number is " << argc-1 << ".\n";
     return 1;
   }
 
@@ -170,16 +199,29 @@ int main(const int argc, const char* const argv[]) {
   const CL::list_bho_t bordv = CL::read_opt<OP::BHO>(argc, argv, 7,
                                                    "bord", "order-heuristics");
   const LAB::vec_t wghts = CL::read_weights(argc, argv, N);
-  const double threads = CL::read_threads(argc, argv, 9);
+  const auto scan_threads = CL::read_scan_threads(argc, argv, 9);
+  const double threads = scan_threads.second;
+  const PF::PortfolioO pfo =
+    CL::read_portfolio(argc, argv, 10, scan_threads.first);
+  if (pfo.race and rt != OP::RT::sat_decision and
+      rt != OP::RT::sat_solving) {
+    std::cerr << error << "Race-mode only for sat-decision or sat-solving.\n";
+    return 1;
+  }
+  if (OP::enum_classes(rt)) {
+    std::cerr << error << "Enumeration of classes not implemented.\n";
+    return 1;
+  }
 
   const std::string outfile = CL::output_filename(proginfo.prg, N);
 
   const bool with_output =
     rt == OP::RT::sat_solving or rt == OP::RT::enumerate_solutions;
   const size_t num_runs = pov.size() * latv.size() * bordv.size();
-  if (with_output and num_runs != 1) {
-    std::cerr << error << "For solution-output the number of runs must be 1,"
-      " but is " << num_runs << ".\n";
+  if (with_output and num_runs != 1 and
+      not (pfo.race and rt == OP::RT::sat_solving)) {
+    std::cerr << error << "For solution-output the number of runs must be 1"
+      " (or race-mode used), but is " << num_runs << ".\n";
     return 1;
   }
   std::ostream* const out = with_output ? new std::ofstream(outfile) : nullptr;
@@ -206,24 +248,52 @@ int main(const int argc, const char* const argv[]) {
   std::cout << "\n# lookahead-weights: ";
   Environment::out_line(std::cout, wghts);
   if (with_output) std::cout << "\n# output-file " << outfile;
+  if (pfo.active()) std::cout << "\n# portfolio " << pfo;
   std::cout << std::endl;
 
+  // The runs, in the order of output:
+  struct run_t {
+    const EC::EncCond* enc; OP::PropO po; OP::LAT lat; OP::BHO bord;
+  };
+  std::vector<std::unique_ptr<const EC::EncCond>> encs;
+  std::vector<run_t> runs; runs.reserve(num_runs);
   for (const OP::PropO po : pov) {
-    const EC::EncCond enc(ac, ps, prop_level(po));
+    encs.push_back(
+      std::make_unique<const EC::EncCond>(ac, ps, prop_level(po),
+                                          special_prop(po)));
     for (const OP::LAT lat : latv)
-      for (const OP::BHO bord : bordv) {
-        const SO::GBasicSR res =
-          SO::solver_la(enc, rt, lat, bord, wghts, threads);
-        using Environment::W0;
-        std::cout << W0(po) << " " << W0(lat) << " " << W0(bord) << " "
-                  << res.b.sol_found << " ";
-        FP::out_fixed_width(std::cout, 3, res.ut);
-        std::cout << " " << res.gs.propagate << " " << res.gs.fail <<
-          " " << res.gs.node << " " << res.gs.depth;
-        std::cout << std::endl;
-        if (with_output)
-          Environment::out_line(*out, res.b.list_sol, "\n");
+      for (const OP::BHO bord : bordv)
+        runs.push_back({encs.back().get(), po, lat, bord});
+  }
+  assert(runs.size() == num_runs);
+
+  std::vector<SO::listsol_t> sols(with_output ? num_runs : 0);
+  const std::size_t winner = PF::run_portfolio<SO::GBasicSR>(num_runs, pfo,
+    [&runs, rt, &wghts, threads](const std::size_t i,
+                                 Gecode::Search::Stop* const stop) {
+      const run_t& r = runs[i];
+      return SO::solver_la(*r.enc, rt, r.lat, r.bord, wghts, threads, stop);
+    },
+    [&runs, &sols, &pfo, with_output]
+    (const std::size_t i, const SO::GBasicSR& res, const PF::RunInfo& info) {
+      const run_t& r = runs[i];
+      using Environment::W0;
+      std::cout << W0(r.po) << " " << W0(r.lat) << " " << W0(r.bord) << " "
+                << res.b.sol_found << " ";
+      FP::out_fixed_width(std::cout, 3, res.ut);
+      std::cout << " " << res.gs.propagate << " " << res.gs.fail <<
+        " " << res.gs.node << " " << res.gs.depth <<
+        " " << res.cs.lookups << " " << res.cs.hits;
+      if (pfo.active()) {
+        std::cout << " " << info.status << " ";
+        FP::out_fixed_width(std::cout, 3, info.wt);
       }
+      std::cout << std::endl;
+      if (with_output) sols[i] = res.b.list_sol;
+    });
+  if (with_output) {
+    const std::size_t i = pfo.race ? winner : 0;
+    if (i < num_runs) Environment::out_line(*out, sols[i], "\n");
   }
   if (out) delete out;
 }
@@ -150,7 +150,7 @@ int main(const int argc, const char* const argv[]) {
   [[deprecated]] assert(latv.size() == 1);
 
   for (const PropO po : pov) {
-    const EC::EncCond enc(ac, ps, prop_level(po));
+    const EC::EncCond enc(ac, ps, prop_level(po), special_prop(po));
     for (const BHV bvar : bvarv)
       for (const BHO bord : bordv) {
         const GBasicSR res =
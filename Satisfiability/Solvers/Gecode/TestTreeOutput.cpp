@@ -6,6 +6,8 @@ the Free Software Foundation and included in this library; either version 3 of t
 License, or any later version. */
 
 #include <sstream>
+#include <vector>
+#include <stdexcept>
 
 #include <cassert>
 
@@ -14,8 +16,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.0.3",
-        "11.3.2022",
+        "0.0.6",
+        "17.10.2026",
         __FILE__,
         "Oleg Zaikin and Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/Gecode/TestTreeOutput.cpp",
@@ -27,14 +29,22 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv))
   return 0;
 
+  {TreeOutput::TreeOutput tl;
+   static_assert(not noexcept(tl.add(TreeOutput::NodeRecord{})));
+   static_assert(not noexcept(tl.add(0, 1, 0, {0,1})));
+   assert(not tl.active());
+  }
+
   {std::ostringstream oss;
    TreeOutput::TreeOutput tl(&oss, TreeOutput::TreeOutputO::none);
+   assert(not tl.active());
    tl.add(0, 1, 0, {0,1});
    assert(oss.str() == "");
    };
 
   {std::ostringstream oss;
    TreeOutput::TreeOutput tl(&oss, TreeOutput::TreeOutputO::reduced);
+   assert(tl.active());
    tl.add(0, 1, 0, {0,1});
    assert(oss.str() == "0 1 0 2 0 1\n");
    };
@@ -52,4 +62,43 @@ int main(const int argc, const char* const argv[]) {
    assert(oss.str() == "0 1 0 2 0 1\n1 2 2 3 7 8 9\n");
    };
 
+  {std::vector<TreeOutput::NodeRecord> R;
+   for (TreeOutput::count_t i = 1; i <= 1000; ++i)
+     R.push_back({i, i/2, i%17, int(i%5), TreeOutput::status_t(i%4),
+                  0.5*i, TreeOutput::values_t(i%4+1, -int(i))});
+   std::stringstream ss;
+   {TreeOutput::BinaryWriter W(&ss, 64);
+    TreeOutput::TreeOutput tl(nullptr, TreeOutput::TreeOutputO::binary, &W);
+    assert(tl.active());
+    for (TreeOutput::count_t i = 0; i < 500; ++i) tl.add(R[i]);
+    W.flush();
+    assert(W.records() == 500);
+    for (TreeOutput::count_t i = 500; i < 1000; ++i) W.add(R[i]);
+   }
+   const std::string bin = ss.str();
+   {TreeOutput::BinaryReader B(ss);
+    TreeOutput::NodeRecord r;
+    for (const auto& r0 : R) { assert(B.next(r)); assert(r == r0); }
+    assert(not B.next(r));
+   }
+   {std::istringstream in(bin); std::ostringstream text, text0;
+    assert(TreeOutput::binary_to_text(in, text) == 1000);
+    for (const auto& r0 : R) TreeOutput::write_text(text0, r0);
+    assert(text.str() == text0.str());
+   }
+   {std::istringstream in(bin.substr(0, bin.size()-1));
+    std::ostringstream text;
+    bool thrown = false;
+    try { TreeOutput::binary_to_text(in, text); }
+    catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown);
+   }
+   {std::istringstream in("OKTX\1\0\0\0");
+    bool thrown = false;
+    try { TreeOutput::BinaryReader B(in); }
+    catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown);
+   }
+  }
+
 }
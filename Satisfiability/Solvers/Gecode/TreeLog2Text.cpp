@@ -0,0 +1,80 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Converting a binary tree-log (TreeOutputO::binary, see TreeOutput.hpp)
+  to the text-format of the tree-output.
+
+  Usage:
+
+> TreeLog2Text file
+
+  outputs the text-lines to standard output; "-" reads standard input.
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+
+#include <ProgramOptions/Environment.hpp>
+
+#include "TreeOutput.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.0",
+        "17.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/Gecode/TreeLog2Text.cpp",
+        "GPL v3"};
+
+  const std::string error = "ERROR[" + proginfo.prg + "]: ";
+
+  bool show_usage(const int argc, const char* const argv[]) {
+    if (not Environment::help_header(std::cout, argc, argv, proginfo))
+      return false;
+    std::cout <<
+    "> " << proginfo.prg << " file\n\n"
+    " converts the binary tree-log in file (\"-\" for standard input)"
+    " to the text-format,\n output to standard output.\n";
+    return true;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
+  if (show_usage(argc, argv)) return 0;
+
+  if (argc != 2) {
+    std::cerr << error << "Exactly one argument (the file) needed, but the"
+      " real number is " << argc-1 << ".\n";
+    return 1;
+  }
+
+  const std::string file = argv[1];
+  std::ifstream fin;
+  if (file != "-") {
+    fin.open(file, std::ios::binary);
+    if (not fin) {
+      std::cerr << error << "Can not open file \"" << file << "\".\n";
+      return 1;
+    }
+  }
+  std::istream& in = file == "-" ? std::cin : fin;
+
+  try { TreeOutput::binary_to_text(in, std::cout); }
+  catch (const std::runtime_error& e) {
+    std::cout.flush();
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+}
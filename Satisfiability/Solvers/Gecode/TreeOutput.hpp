@@ -1,5 +1,5 @@
 // Oleg Zaikin, 9.3.2022 (Swansea)
-/* Copyright 2022 Oliver Kullmann
+/* Copyright 2022, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -14,11 +14,51 @@ id, depth, branching variable, branching width, values of the branching
 variable (each of which corresponds to a branch):
 The delimiter is space.
 
+Binary tree-log (TreeOutputO::binary):
+
+ - struct NodeRecord: id, parent-id, depth, branching variable, values of
+   the branches, ltau of the branching, and status (as Statistics::BrStatus)
+ - write_text(out, r) writes r in the above text-format
+ - class BinaryWriter appends records to a buffer, and a writer-thread
+   writes the full buffers (of size at least bufsize) to the stream;
+   add() may be called concurrently
+ - class BinaryReader reads the records back; binary_to_text(in, out)
+   converts a complete binary log to the text-format.
+
+The binary format (all numbers in native byte-order):
+ - header: the 4 bytes of binary_magic, followed by binary_version (uint32)
+ - each record: id (uint64), parent (uint64), depth (uint32), var (int32),
+   status (uint8), ltau (float64), width (uint32), and then width many
+   values (int32).
+
+TreeOutput::add is not noexcept, since BinaryWriter::add may throw (e.g.
+std::bad_alloc); the exception propagates out of the brancher's choice().
+
+Tree-output (in all forms) is only connected to Euler (Euler.hpp, via
+Lookahead::Node); the other users of Lookahead.hpp (the MOLS-solvers) do
+not offer it.
+
 */
 
 #ifndef TREEOUTPUT_kb005ZOtd6
 #define TREEOUTPUT_kb005ZOtd6
 
+#include <vector>
+#include <deque>
+#include <string>
+#include <ostream>
+#include <istream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
 #include <ProgramOptions/Environment.hpp>
 
 namespace TreeOutput {
@@ -27,43 +67,248 @@ namespace TreeOutput {
 
   typedef std::uint64_t count_t;
   typedef std::vector<int> values_t;
+  typedef std::uint8_t status_t; // the values of Statistics::BrStatus
 
   // Types of tree output.
   // none    - no output.
   // reduced - id, depth, branching variable, values of child branches,
   // full    - as reduced, but with states of variables before and after
   //           lookahead reduction.
-  enum class TreeOutputO {none=0, reduced=1, full=2};
+  // binary  - as reduced, plus parent-id, ltau and status, in binary
+  //           format via BinaryWriter.
+  // Only used by Euler.
+  enum class TreeOutputO {none=0, reduced=1, full=2, binary=3};
 
   std::ostream& operator <<(std::ostream& out, const TreeOutput::TreeOutputO llo) {
     switch (llo) {
     case TreeOutput::TreeOutputO::reduced : return out << "reduced-logging";
     case TreeOutput::TreeOutputO::full : return out << "full-logging";
+    case TreeOutput::TreeOutputO::binary : return out << "binary-logging";
     default : return out << "no-logging";}
   }
 
+
+  struct NodeRecord {
+    count_t id = 0;
+    count_t parent = 0;
+    count_t depth = 0;
+    int var = 0;
+    status_t status = 3;
+    double ltau = std::numeric_limits<double>::infinity();
+    values_t values;
+    bool operator ==(const NodeRecord&) const noexcept = default;
+  };
+
+  // The text-format:
+  inline void write_text(std::ostream& out, const NodeRecord& r) {
+    out << r.id << " " << r.depth << " " << r.var << " " << r.values.size()
+        << " ";
+    for (count_t i=0; i<r.values.size(); ++i) {
+      out << r.values[i];
+      if (r.values.size() > 1 and i < r.values.size() - 1) out << " ";
+    }
+    out << "\n";
+  }
+
+
+  constexpr char binary_magic[4] = {'O','K','T','L'};
+  constexpr std::uint32_t binary_version = 1;
+  constexpr std::size_t record_fixed_size = 8+8+4+4+1+8+4;
+
+  namespace detail {
+    template <typename T>
+    inline void put(std::vector<char>& buf, const T x) {
+      const std::size_t s = buf.size();
+      buf.resize(s + sizeof(T));
+      std::memcpy(buf.data() + s, &x, sizeof(T));
+    }
+    template <typename T>
+    inline T get(const char*& p) noexcept {
+      T x; std::memcpy(&x, p, sizeof(T)); p += sizeof(T); return x;
+    }
+  }
+
+  // Appending the binary representation of r to buf:
+  inline void encode(std::vector<char>& buf, const NodeRecord& r) {
+    assert(r.depth <= std::numeric_limits<std::uint32_t>::max());
+    detail::put<std::uint64_t>(buf, r.id);
+    detail::put<std::uint64_t>(buf, r.parent);
+    detail::put<std::uint32_t>(buf, r.depth);
+    detail::put<std::int32_t>(buf, r.var);
+    detail::put<std::uint8_t>(buf, r.status);
+    detail::put<double>(buf, r.ltau);
+    detail::put<std::uint32_t>(buf, r.values.size());
+    for (const int v : r.values) detail::put<std::int32_t>(buf, v);
+  }
+
+
+  class BinaryWriter {
+  public :
+    static constexpr std::size_t default_bufsize = 1 << 20;
+
+    explicit BinaryWriter(std::ostream* const out,
+                          const std::size_t bufsize = default_bufsize) :
+      out(out), bufsize(std::max(bufsize, record_fixed_size)),
+      worker([this]{ run(); }) {
+      assert(out);
+      std::vector<char> h(binary_magic, binary_magic+4);
+      detail::put<std::uint32_t>(h, binary_version);
+      h.swap(current);
+    }
+    BinaryWriter(const BinaryWriter&) = delete;
+    ~BinaryWriter() {
+      {std::lock_guard l(m); hand_over(); closed = true;}
+      cv.notify_all();
+      worker.join();
+      out->flush();
+    }
+
+    void add(const NodeRecord& r) {
+      std::unique_lock l(m);
+      encode(current, r);
+      ++num_records;
+      if (current.size() >= bufsize) {
+        hand_over(); l.unlock(); cv.notify_all();
+      }
+    }
+
+    // Waits until all records added so far are written:
+    void flush() {
+      std::unique_lock l(m);
+      hand_over();
+      cv.notify_all();
+      cv.wait(l, [this]{ return pending.empty() and not writing; });
+      out->flush();
+    }
+
+    count_t records() const { std::lock_guard l(m); return num_records; }
+
+  private :
+    std::ostream* const out;
+    const std::size_t bufsize;
+    std::vector<char> current;
+    std::deque<std::vector<char>> pending;
+    bool closed = false, writing = false;
+    count_t num_records = 0;
+    mutable std::mutex m;
+    std::condition_variable cv;
+    std::thread worker;
+
+    // Assumes the lock is held:
+    void hand_over() {
+      if (current.empty()) return;
+      pending.push_back(std::move(current));
+      current.clear(); current.reserve(bufsize + record_fixed_size);
+    }
+
+    void run() {
+      std::unique_lock l(m);
+      for (;;) {
+        cv.wait(l, [this]{ return closed or not pending.empty(); });
+        if (pending.empty()) return;
+        std::vector<char> buf = std::move(pending.front());
+        pending.pop_front();
+        writing = true;
+        l.unlock();
+        out->write(buf.data(), buf.size());
+        l.lock();
+        writing = false;
+        cv.notify_all();
+      }
+    }
+  };
+
+
+  class BinaryReader {
+    std::istream& in;
+    std::vector<char> buf;
+  public :
+    // Reads the header:
+    explicit BinaryReader(std::istream& in) : in(in), buf(8) {
+      if (not in.read(buf.data(), 8) or
+          not std::equal(buf.begin(), buf.begin()+4, binary_magic))
+        throw std::runtime_error("ERROR[TreeOutput::BinaryReader]: "
+                                 "not a binary tree-log.");
+      const char* p = buf.data() + 4;
+      const auto v = detail::get<std::uint32_t>(p);
+      if (v != binary_version)
+        throw std::runtime_error("ERROR[TreeOutput::BinaryReader]: "
+                                 "unknown version " + std::to_string(v) + ".");
+    }
+
+    // False at the end of the log:
+    bool next(NodeRecord& r) {
+      buf.resize(record_fixed_size);
+      in.read(buf.data(), record_fixed_size);
+      if (in.gcount() == 0 and in.eof()) return false;
+      if (std::size_t(in.gcount()) != record_fixed_size) truncated();
+      const char* p = buf.data();
+      r.id = detail::get<std::uint64_t>(p);
+      r.parent = detail::get<std::uint64_t>(p);
+      r.depth = detail::get<std::uint32_t>(p);
+      r.var = detail::get<std::int32_t>(p);
+      r.status = detail::get<std::uint8_t>(p);
+      r.ltau = detail::get<double>(p);
+      const auto w = detail::get<std::uint32_t>(p);
+      const std::size_t s = std::size_t(w) * 4;
+      buf.resize(s);
+      if (s != 0 and not in.read(buf.data(), s)) truncated();
+      p = buf.data();
+      r.values.resize(w);
+      for (auto& v : r.values) v = detail::get<std::int32_t>(p);
+      return true;
+    }
+
+  private :
+    [[noreturn]] static void truncated() {
+      throw std::runtime_error("ERROR[TreeOutput::BinaryReader]: "
+                               "truncated record.");
+    }
+  };
+
+  // Returns the number of records:
+  inline count_t binary_to_text(std::istream& in, std::ostream& out) {
+    BinaryReader R(in);
+    NodeRecord r;
+    count_t n = 0;
+    while (R.next(r)) { write_text(out, r); ++n; }
+    return n;
+  }
+
+
 // Class for logging tree-data.
   class TreeOutput {
     treeoutput_t out;
     TreeOutputO outlvl;
+    BinaryWriter* bout;
   public:
     TreeOutput(treeoutput_t out = nullptr,
-               const TreeOutputO outlvl = TreeOutputO::none) :
-               out(out), outlvl(outlvl) {}
+               const TreeOutputO outlvl = TreeOutputO::none,
+               BinaryWriter* const bout = nullptr) :
+               out(out), outlvl(outlvl), bout(bout) {
+      assert(outlvl != TreeOutputO::binary or bout);
+    }
+
+    // Whether add() writes anything:
+    bool active() const noexcept {
+      return outlvl == TreeOutputO::binary or
+        (out != nullptr and outlvl != TreeOutputO::none);
+    }
 
     // Add data to a out:
     void add(const count_t id, const count_t dpth, const int branchvar,
-             const values_t values) noexcept {
-      assert(not values.empty());
+             const values_t values) {
+      NodeRecord r; r.id = id; r.depth = dpth; r.var = branchvar;
+      r.values = values;
+      add(r);
+    }
+    void add(const NodeRecord& r) {
+      assert(not r.values.empty());
+      if (outlvl == TreeOutputO::binary) { bout->add(r); return; }
       if (out == nullptr or outlvl == TreeOutputO::none) return;
       // First write basic data:
-      *out << id << " " << dpth << " " << branchvar << " " << values.size()
-           << " ";
-      for (count_t i=0; i<values.size(); ++i) {
-        *out << values[i];
-        if (values.size() > 1 and i < values.size() - 1) *out << " ";
-      }
-      *out << std::endl;
+      write_text(*out, r);
+      out->flush();
       // Write states of variables if given:
       if (outlvl == TreeOutputO::full) {
         // XXX
@@ -76,9 +321,9 @@ namespace TreeOutput {
 namespace Environment {
   template <>
   struct RegistrationPolicies<TreeOutput::TreeOutputO> {
-    static constexpr int size = int(TreeOutput::TreeOutputO::full)+1;
+    static constexpr int size = int(TreeOutput::TreeOutputO::binary)+1;
     static constexpr std::array<const char*, size> string
-    {"noout", "rdcdout", "fullout"};
+    {"noout", "rdcdout", "fullout", "binout"};
   };
 }
 
@@ -48,13 +48,16 @@ License, or any later version. */
      <li> This will yield a subset of the assignments made by the OKsolver, and
      it is relevant to see, since it is what the sub-solvers like minisat will
      see. </li>
-     <li> We should write a C++ application, which reads once the main
+     <li> DONE (Interfaces/DistributedSolving/UCPSplitViaOKsolver.cpp)
+     We should write a C++ application, which reads once the main
      clause-set, and then uses our UCP component, outputting the sizes of
      the partial assignments computed for each decision-partial-assignment
      to standard output. </li>
-     <li> This should be reasonably fast, since it doesn't need resetting.
+     <li> DONE (only the assignment is reset per cube)
+     This should be reasonably fast, since it doesn't need resetting.
      </li>
-     <li> This should be done just before the md5sum-computation. </li>
+     <li> DONE (file UCP)
+     This should be done just before the md5sum-computation. </li>
     </ol>
    </li>
   </ul>
@@ -46,7 +46,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
   COMPILE with
 
-> g++ --std=c++11 -Wall -Ofast -DNDEBUG -o tawSolver tawSolver.cpp
+> g++ --std=c++20 -Wall -Ofast -DNDEBUG -o tawSolver tawSolver.cpp -pthread
 
   possibly with additional optimisation-options
 
@@ -55,7 +55,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
   or with
 
-> g++ --std=c++11 -Wall -g -o tawSolver_debug tawSolver.cpp
+> g++ --std=c++20 -Wall -g -o tawSolver_debug tawSolver.cpp -pthread
 
   for debugging.
 
@@ -63,7 +63,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
   alternative is to compute all solutions (represented by partial assignments),
   which is obtained (similar to above) via
 
-> g++ --std=c++11 -Wall -Ofast -DNDEBUG -DALL_SOLUTIONS -o ctawSolver tawSolver.cpp
+> g++ --std=c++20 -Wall -Ofast -DNDEBUG -DALL_SOLUTIONS -o ctawSolver tawSolver.cpp -pthread
 
 
   Alternatively the makefile (called "makefile") in this
@@ -113,6 +113,12 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
   Output to file means appending.
 
+  Input from a (regular) file is read via memory-mapping, where the clauses
+  are tokenised in parallel (using at most N threads, given by the option
+  "-rthreads=N" (anywhere), by default the number of hardware threads, and
+  at most one thread per MB); the results (and the errors) are exactly the
+  same as for reading from standard input.
+
   Empty clauses or unit-clauses in the input are errors.
   The parameters in the p-line are considered as upper bounds (so not reaching
   them is not considered an error), where tautological clauses are ignored.
@@ -143,6 +149,15 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
    - ALL_SOLUTIONS: if defined (default is undefined), then all solutions are
      computed, and they are output as soon as when they are found;
      incompatible with PURE_LITERALS.
+     If the solutions-output is not the statistics-output (and no
+     splitting, see below), then the solutions are written by a separate
+     writer-thread (see class SolutionWriter), in blocks and without
+     flushing for each solution (the output is otherwise the same; see
+     data/SolutionOutput).
+   - GZIP_SOLUTIONS: if defined (default is undefined), then the
+     solutions-output to a file with name ending in ".gz" is
+     gzip-compressed (linking needs -lz; Makefile-target
+     ctawSolver_gz); appending to an existing file adds a new gzip-member.
    - VAR_MARGINALS, which implies ALL_SOLUTIONS means that the statistics
      list at the end for each variable the number of satisfying assignments
      where this variable is set to true.
@@ -150,7 +165,46 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
      integral type with at least 64 bits (so modular arithmetic is performed,
      namely modulo 2^count_bits);
      can also be defined as e.g. "double" or "long double", in which case the
-     result may become "inf".
+     result may become "inf", or as "__uint128_t" (Makefile-target
+     ctawSolver_128);
+     the powers 2^n for the leaves are computed by shifting for the
+     built-in integral types, and are cached otherwise.
+   - GMP_COUNT: if defined (default is undefined), then COUNT_T is mpz_class
+     (exact counting with GMP; linking needs -lgmpxx -lgmp; Makefile-target
+     ctawSolver_gmp); see data/CountTypes for the costs.
+   - FLAT_CLAUSES: if defined (default is undefined), then all clauses are
+     stored in one arena (clause-header followed by the literals), and the
+     literal-occurrences are 32-bit offsets into that arena (instead of
+     pointers); see data/FlatClauses for a benchmark.
+   - INCREMENTAL_SCORES: if defined (default is undefined), then the
+     weight-sums for the literals are maintained under assignment and
+     backtracking (see class Scores), instead of recomputing them for each
+     variable at each node; the costs are shifted from the branching
+     (now time O(n)) to the changes of clause-lengths (time O(k) for a
+     clause of length k), so this pays off only for short clauses (see
+     data/IncrementalScores); the weights are rounded to multiples of
+     2^-32, so ties can be broken differently;
+     incompatible with FIRST_VARIABLE and LAMBDA.
+   - PHASE_STATISTICS: if defined (default is undefined), then for the
+     phases assign_0, assign_1, push_unit_clause, branching_literal,
+     reactivate_0 and reactivate_1 of the search the number of calls and
+     the cycles (time-stamp-counter; inclusive of nested phases) are
+     counted, and output at the end of the statistics (also on SIGUSR1);
+     without the macro there is no code for this at all; costs about 40%
+     run-time (see data/PhaseStatistics; Makefile-targets tawSolver_phases,
+     ctawSolver_phases).
+   - STREAM_READING: if defined (default is undefined), then the input is
+     always read as a stream (not memory-mapped).
+   - PARALLEL: if defined (default is undefined), then the search can use
+     several threads (see "Parallel search" below); incompatible with
+     PURE_LITERALS (and thus with FIRST_VARIABLE).
+   - SOLVER_CORE: if defined (default is undefined), then there is no
+     main-function, and this file can be included into another program,
+     using the solver-core (reading via load_formula, and solving cubes via
+     thread_initialisation, copy_formula and conquer, as the workers in
+     parallel_run); requires PARALLEL (so that each thread has its own
+     search-data), and is incompatible with ALL_SOLUTIONS; see
+     Interfaces/DistributedSolving/ConquerSplitViaOKsolver.cpp.
 
   To provide further version-information, there are two macros, which are
   only relevant if they are defined:
@@ -168,14 +222,25 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
      the input.
    - "running_time(sec)" is only solver-time.
    - running_time + reading-and-set-up_time is total time.
+   - The reading-and-set-up phases (wall-clock) are: parsing_time (p-line
+     and tokenising the clauses, using reading_threads many threads),
+     clauses_time (creating the clauses from the tokens), occurrences_time
+     (the literal-occurrences) and initialisation_time (the other algorithmic
+     data structures); for stream-input the clauses are created while
+     parsing (and clauses_time is zero).
    - A "binary node" is one with (exactly) two children.
    - A "1-reduction" is an assignment due to unit-clause propagation.
    - "options" yields a summary of the main options:
+    - "p" for PARALLEL
+    - "a" for FLAT_CLAUSES (the clause-arena)
+    - "i" for INCREMENTAL_SCORES
+    - "S" for PHASE_STATISTICS
     - "B" for UCP_STRATEGY = 0
     - "P" for PURE_LITERALS
     - "T" followed with its value if defined
     - "A" for ALL_SOLUTIONS, plus "F" in case of floating-point counting, and
-      followed by the number of (decimal) digits.
+      followed by the number of (decimal) digits, or followed by "G" for
+      GMP_COUNT.
     - If VAR_MARGINALS is defined, then instead of "A" there is "M".
 
   If solutions-output is cout, then it comes after the statistics, except for
@@ -215,6 +280,100 @@ c options                               "A19"
 or
 > timeout -s SIGINT 0.7 tawSolver [options]
 
+
+  PARALLEL SEARCH:
+
+  If compiled with PARALLEL (the Makefile-targets ptawSolver and pctawSolver;
+  linking needs -pthread), then additionally the option
+
+    -threads=N
+
+  is available (anywhere on the command-line; default is the number of
+  hardware threads), running N worker-threads. Each worker has its own
+  (thread-local) copy of the clauses, literal-occurrences and all other
+  search-data, and the search tree is split at the branching literals:
+  whenever a worker runs out of work, it signals this, and the next busy
+  worker arriving at a node donates the still-unexplored second branch
+  closest to the root of its decision path. A donated job is the sequence
+  of decisions leading to that branch; the receiving worker replays these
+  decisions (statistics "replayed_decisions", not counted as nodes), and
+  continues the search from there. So the search tree is exactly the same
+  as for the sequential solver (the branching literal only depends on the
+  current partial assignment); for ALL_SOLUTIONS (and VAR_MARGINALS) the
+  counts (and the node-counts) are the sums over the workers, and are
+  thus identical to those of the sequential solver (except of the order of
+  solution-output). Without ALL_SOLUTIONS, the first satisfying assignment
+  found stops all workers.
+  The statistics output on SIGINT/SIGUSR1 only contains the counts of the
+  main thread (the other workers add their counts when they finish).
+
+
+  CUBE-AND-CONQUER:
+
+  With the option (anywhere on the command-line)
+
+    -split=depth:D   resp.   -split=nodes:N
+
+  the formula is only split: the search (sequential, also with PARALLEL)
+  is stopped at the nodes with D decisions resp. at all nodes after the
+  first N nodes, and for each such node its cube, the sequence of the
+  decisions leading to it, is output as a line "a x1 ... xk 0" (iCNF) to
+  the solutions-output (so for ALL_SOLUTIONS this output needs to be
+  given). Without ALL_SOLUTIONS, when finding a satisfying assignment the
+  run stops with the usual result, while for ALL_SOLUTIONS also the
+  satisfied leaves are output as cubes. The result is UNSATISFIABLE if
+  no cube was output, and otherwise UNKNOWN (if no solution was found).
+  The statistics additionally show the splitting and number_of_cubes.
+
+  With the option
+
+    -conquer=cubefile
+
+  all cubes in cubefile (the lines starting with "a ", so that also a
+  complete iCNF-file can be used) are conquered: the literals of a cube are
+  assigned in order, each followed by unit-clause propagation, and the
+  remaining formula is solved. With PARALLEL, all workers first take cubes
+  (and then steal work as for the normal search). The result is
+  SATISFIABLE iff some cube is satisfiable, and for ALL_SOLUTIONS (and
+  VAR_MARGINALS) the counts are the sums over the cubes; for the cubes
+  from splitting (which are disjoint and cover all solutions) this yields
+  exactly the counts for the whole formula, for example:
+
+> ctawSolver F.cnf Cubes -split=depth:10
+> pctawSolver F.cnf -conquer=Cubes -threads=16
+
+  The cubes can only use variables occurring in the formula (error
+  otherwise).
+
+
+  CHECKPOINTS:
+
+  Without PARALLEL, with the option (anywhere on the command-line)
+
+    -checkpoint=file
+
+  the state of the search is written to file (via file.tmp, which is then
+  renamed) on SIGUSR2 and every S seconds (option "-cpinterval=S", default
+  3600); SIGINT then first writes a checkpoint and afterwards aborts as
+  usual (a second SIGINT aborts at once). The checkpoint is taken at the
+  beginning of the next node, and consists of the statistics so far
+  (including the solution-count and the marginals) and the decision path
+  to that node (with the information which second branches are still
+  pending). With
+
+    -resume=file
+
+  the search is continued from the checkpoint (the options and the formula
+  must be the same): the decisions of the path are replayed, and the
+  search continues with that node and then the pending second branches.
+  The counts at the end are for the whole search (exactly the same as
+  without interruption), while the times are only those of the last run;
+  with PURE_LITERALS, the pure literals of the path are not replayed, and
+  thus might be counted again. For example, for a long counting-run:
+
+> ctawSolver F.cnf -nil -checkpoint=F.cp -cpinterval=600
+> ctawSolver F.cnf -nil -checkpoint=F.cp -resume=F.cp
+
 */
 
 #include <limits>
@@ -227,23 +386,64 @@ or
 #include <type_traits>
 #include <iomanip>
 #include <exception>
+#include <stdexcept>
 #include <algorithm>
+#include <new>
+#include <cstring>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <charconv>
+#include <bit>
+
+#include <map>
 
 #include <cstdlib>
+#include <cstdio>
 #include <cmath>
 #include <cstdint>
 #include <cassert>
 #include <csignal>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#ifdef GMP_COUNT
+# include <gmpxx.h>
+#endif
+#if defined PHASE_STATISTICS and (defined __x86_64__ or defined __i386__)
+# include <x86intrin.h>
+#endif
+#ifdef GZIP_SOLUTIONS
+# include <zlib.h>
+#endif
+
+#ifdef PARALLEL
+# include <mutex>
+# include <condition_variable>
+# include <deque>
+# include <latch>
+#endif
+
 namespace {
 
 #define is_pod(X) std::is_standard_layout_v<X> and std::is_trivial_v<X>
 
+/* All data changed during search is declared as TL, which for parallel
+   search means thread-local (each worker has its own copy): */
+#ifdef PARALLEL
+# define TL thread_local
+#else
+# define TL
+#endif
+
 // --- General input and output ---
 
-const std::string version = "2.20.2";
-const std::string date = "16.4.2022";
+const std::string version = "2.31.0";
+const std::string date = "17.10.2026";
 
 #if defined WEIGHT_2 | defined WEIGHT_4 | defined WEIGHT_5 | defined WEIGHT_6 | defined WEIGHT_BASIS_OPEN | defined TWEIGHT_2 | defined TWEIGHT_4 | defined TWEIGHT_5 | defined TWEIGHT_6 | defined TWEIGHT_BASIS_OPEN
 # define WEIGHT_DEFINED
@@ -258,7 +458,29 @@ const std::string date = "16.4.2022";
 # endif
 #endif
 
+#ifdef PARALLEL
+# ifdef PURE_LITERALS
+#  error "PARALLEL not compatible with PURE_LITERALS."
+# endif
+#endif
+#ifdef SOLVER_CORE
+# ifndef PARALLEL
+#  error "SOLVER_CORE requires PARALLEL."
+# endif
+# ifdef ALL_SOLUTIONS
+#  error "SOLVER_CORE not compatible with ALL_SOLUTIONS."
+# endif
+#endif
+#ifdef INCREMENTAL_SCORES
+# if defined FIRST_VARIABLE | defined LAMBDA
+#  error "INCREMENTAL_SCORES not compatible with FIRST_VARIABLE or LAMBDA."
+# endif
+#endif
+
 const std::string program =
+#ifdef PARALLEL
+  "p"
+#endif
 #if defined ALL_SOLUTIONS
   "c"
 #elif defined VAR_MARGINALS
@@ -280,6 +502,15 @@ const std::string program =
 #ifdef ALPHA
   "_alpha"
 #endif
+#ifdef FLAT_CLAUSES
+  "_flat"
+#endif
+#ifdef INCREMENTAL_SCORES
+  "_incr"
+#endif
+#ifdef PHASE_STATISTICS
+  "_phases"
+#endif
 #ifndef NDEBUG
   "_debug"
 #endif
@@ -295,7 +526,10 @@ enum Error_codes {
   variable_value_error=7,
   number_clauses_error=8,
   empty_clause_error=9,
-  unit_clause_error=11
+  unit_clause_error=11,
+  option_error=12,
+  cube_error=13,
+  checkpoint_error=14
 };
 
 // The following three return-values are not errors:
@@ -307,6 +541,15 @@ inline constexpr Result_value interprete_run(const DLL_return_t result) noexcept
 }
 
 
+// Output of unsigned 128-bit integers (for COUNT_T = __uint128_t):
+[[maybe_unused]] std::ostream& operator <<(std::ostream& out, __uint128_t x) {
+  char buf[40];
+  char* const end = buf + 40;
+  char* p = end;
+  do { *--p = char('0' + x % 10); x /= 10; } while (x != 0);
+  return out << std::string(p, end);
+}
+
 /* Class for output-objects solout, logout, errout, which are initialised
    by function set_output from the command-line parameters. The two
    public members (besides the constructor) are
@@ -320,8 +563,10 @@ class Output {
   bool del = false;
   friend void set_output(const int, const char* const*);
   friend class Outputerr;
+  friend class SolutionWriter;
 public :
   bool active() const noexcept { return p != nullptr; }
+  bool shares(const Output& o) const noexcept { return p == o.p; }
   ~Output() { if (del) delete p; }
   template <typename T>
   const Output& operator <<(const T& x) const { if (p) *p << x; return *this; }
@@ -336,6 +581,7 @@ Output logout;
 // Error output with ERROR-prefix, and each on a new line:
 struct Outputerr : Output {
   const std::string e = "ERROR[" + program + "]: ";
+  Outputerr() noexcept { p = &std::cerr; }
   template <typename T>
   const Outputerr& operator <<(const T& x) const {
     if (p) *p << e << x << "\n";
@@ -344,6 +590,44 @@ struct Outputerr : Output {
 };
 Outputerr errout;
 
+#ifdef GZIP_SOLUTIONS
+/* Output-stream writing gzip-compressed to a file (appending a new
+   gzip-member, so that the file stays a valid gzip-file); used by set_output
+   for filenames ending with ".gz":
+*/
+class Gzbuf : public std::streambuf {
+  const gzFile f;
+  std::array<char, 1 << 16> buf;
+public :
+  explicit Gzbuf(const std::string& name) noexcept :
+    f(gzopen(name.c_str(), "ab")) { setp(buf.data(), buf.data()+buf.size()); }
+  bool is_open() const noexcept { return f != nullptr; }
+  ~Gzbuf() { if (f) { sync(); gzclose(f); } }
+protected :
+  int_type overflow(const int_type c) override {
+    if (sync() != 0) return traits_type::eof();
+    if (not traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c); pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+  int sync() override {
+    const int n = pptr() - pbase();
+    if (n != 0 and gzwrite(f, pbase(), n) != n) return -1;
+    setp(buf.data(), buf.data()+buf.size());
+    return 0;
+  }
+};
+class Gzostream : public std::ostream {
+  Gzbuf b;
+public :
+  explicit Gzostream(const std::string& name) : std::ostream(nullptr), b(name) {
+    rdbuf(&b);
+    if (not b.is_open()) setstate(std::ios::badbit);
+  }
+};
+#endif
+
 
 // --- Data structures for literals and variables ---
 
@@ -481,11 +765,30 @@ typedef std::uint_fast64_t Count_clauses;
 // Used for input-reading and initialisation:
 typedef std::vector<std::array<Count_clauses,2>> Count_vec;
 
-Count_clauses r_clauses; // "r" = "remaining"
+TL Count_clauses r_clauses; // "r" = "remaining"
+
+#ifdef INCREMENTAL_SCORES
+class Clause;
+// Updating the scores of the literals in C for the change of its length
+// from l0 to l1 (see class Scores below):
+inline void update_scores(const Clause& C, Clause_index l0, Clause_index l1) noexcept;
+#endif
+
+#ifdef FLAT_CLAUSES
+/* All clauses are stored in one arena (per thread), of words of type
+   Clause_word: each clause is its header (the Clause-object) followed by its
+   literals (in the arena-words, which have the size of literals). */
+typedef Clause_index Clause_word;
+static_assert(sizeof(Lit) == sizeof(Clause_word), "Literals need the size of arena-words.");
+#endif
 
 class Clause {
+#ifndef FLAT_CLAUSES
   const Lit* b; // the array of literals in the clause (as in the input)
   const Lit* e; // one past-the-end
+#else
+  Clause_index size_; // the number of literals (following in the arena)
+#endif
   Clause_index length_; // the current length, or 0 iff clause is satisfied
   Clause_index old_length; // if satisfied, the length before satisfaction
   // The following function (for initialisation) sets these data members
@@ -494,30 +797,59 @@ class Clause {
 
   // The friends below (for updating the length) only access the following
   // member functions:
-  void decrement() noexcept { assert(length_ >= 2); --length_; }
-  void increment() noexcept { assert(length_ >= 1); ++length_; }
+  void decrement() noexcept {
+    assert(length_ >= 2); --length_;
+#ifdef INCREMENTAL_SCORES
+    update_scores(*this, length_+1, length_);
+#endif
+  }
+  void increment() noexcept {
+    assert(length_ >= 1); ++length_;
+#ifdef INCREMENTAL_SCORES
+    update_scores(*this, length_-1, length_);
+#endif
+  }
   void deactivate() noexcept {
     assert(length_ >= 1);
     old_length = length_;
     length_ = 0;
     assert(r_clauses >= 1);
     --r_clauses;
+#ifdef INCREMENTAL_SCORES
+    update_scores(*this, old_length, 0);
+#endif
   }
   void activate() noexcept {
     assert(length_ == 0);
     length_ = old_length;
     ++r_clauses;
+#ifdef INCREMENTAL_SCORES
+    update_scores(*this, 0, length_);
+#endif
   }
   friend class ChangeManagement;
   friend void assign_0(Lit) noexcept;
   friend void assign_1(Lit) noexcept;
 public :
+#ifndef FLAT_CLAUSES
   const Lit* begin() const noexcept { return b; }
   const Lit* end() const noexcept { return e; }
+#else
+  const Lit* begin() const noexcept {
+    return std::launder(reinterpret_cast<const Lit*>(this + 1));
+  }
+  const Lit* end() const noexcept { return begin() + size_; }
+  // The number of arena-words of the clause (header and literals):
+  Clause_index words() const noexcept { return header_words + size_; }
+  static constexpr Clause_index header_words = 3;
+#endif
   Clause_index length() const noexcept { return length_; }
   explicit operator bool() const noexcept { return length_; }
 };
 static_assert(is_pod(Clause), "Clause is not POD.");
+#ifdef FLAT_CLAUSES
+static_assert(sizeof(Clause) == Clause::header_words * sizeof(Clause_word) and alignof(Clause) == alignof(Lit), "Clause-header not aligned with literals.");
+#endif
 
 std::ostream& operator <<(std::ostream& out, const Clause& C) {
   for (const Lit x : C) out << x << " ";
@@ -525,22 +857,79 @@ std::ostream& operator <<(std::ostream& out, const Clause& C) {
 }
 
 typedef Clause* ClauseP;
+typedef std::vector<ClauseP> ClauseP_vec;
 
+#ifndef FLAT_CLAUSES
 typedef std::vector<Clause> Clause_vec;
-typedef std::vector<ClauseP> ClauseP_vec;
+// Pointers to the clauses in the literal-occurrences:
+typedef ClauseP Clause_ref;
+// Calling f(C, R) for all clauses C, with R the reference to C:
+template <class F> void for_each_clause(const Clause_vec& cl, F f) {
+  for (const Clause& C : cl) f(C, const_cast<ClauseP>(&C));
+}
+#else
+typedef std::vector<Clause_word> Clause_vec; // the arena
+
+TL Clause_word* clause_arena; // the arena of the current thread
+
+// The literal-occurrences use the (half-size) offsets into the arena:
+class Clause_ref {
+  Clause_index i;
+public :
+  Clause_ref() noexcept = default;
+  explicit constexpr Clause_ref(const Clause_index i) noexcept : i(i) {}
+  ClauseP operator ->() const noexcept {
+    return std::launder(reinterpret_cast<ClauseP>(clause_arena + i));
+  }
+  Clause& operator *() const noexcept { return *operator->(); }
+  operator ClauseP() const noexcept { return operator->(); }
+};
+static_assert(is_pod(Clause_ref), "Clause_ref is not POD.");
+
+template <class F> void for_each_clause(const Clause_vec& cl, F f) {
+  for (Clause_index i = 0; i != cl.size();) {
+    const Clause& C = *std::launder(reinterpret_cast<const Clause*>(&cl[i]));
+    f(C, Clause_ref(i));
+    i += C.words();
+  }
+}
+
+/* Starting the lifetimes of the clause-headers and literals in the arena A,
+   after its words have been copied (by copying the vector, or by its
+   reallocation when growing): the values are read via std::bit_cast from
+   the words, and the objects are created via placement-new (this is a
+   no-op in the generated code): */
+void construct_clauses(Clause_vec& A) noexcept {
+  typedef std::array<Clause_word, Clause::header_words> header_t;
+  for (Clause_index i = 0; i != A.size();) {
+    header_t hw;
+    std::copy_n(A.begin() + i, Clause::header_words, hw.begin());
+    const Clause& C = *new (&A[i]) Clause(std::bit_cast<Clause>(hw));
+    Clause_word* const b = &A[i] + Clause::header_words;
+    for (Clause_index j = 0; j != C.words() - Clause::header_words; ++j)
+      new (b + j) Lit(std::bit_cast<Lit>(b[j]));
+    i += C.words();
+  }
+}
+#endif
+typedef std::vector<Clause_ref> Clause_ref_vec;
 
 
 // --- Data structures for literal occurrences ---
 
+#ifdef PARALLEL
+class Clauses;
+#endif
+
 class LiteralOccurrences {
 
   class Literal_occurrences {
-    const ClauseP* b; // array with clause-pointers
-    const ClauseP* e; // one past-the-end
+    const Clause_ref* b; // array with clause-references
+    const Clause_ref* e; // one past-the-end
     friend class LiteralOccurrences;
   public :
-    const ClauseP* begin() const noexcept { return b; }
-    const ClauseP* end() const noexcept { return e; }
+    const Clause_ref* begin() const noexcept { return b; }
+    const Clause_ref* end() const noexcept { return e; }
   };
 static_assert(is_pod(Literal_occurrences), "Literal_occurrences is not POD.");
 
@@ -549,13 +938,13 @@ static_assert(is_pod(Literal_occurrences), "Literal_occurrences is not POD.");
   typedef vec_varocc::size_type size_type;
 
   vec_varocc varocc;
-  ClauseP_vec all_lit_occurrences;
+  Clause_ref_vec all_lit_occurrences;
 
   void init(const size_type s, const Var n, const Clause_vec& clauses, Count_vec& count) {
     if (s == 0) return;
     varocc.resize(n+1);
     all_lit_occurrences.resize(s);
-    const ClauseP* pointer = &all_lit_occurrences[0];
+    const Clause_ref* pointer = &all_lit_occurrences[0];
     for (Var v = 1; v <= n; ++v)
       for (int p = 0; p <= 1; ++p) {
         auto& L = varocc[v][p];
@@ -564,19 +953,37 @@ static_assert(is_pod(Literal_occurrences), "Literal_occurrences is not POD.");
         L.e = pointer;
       }
     assert(pointer == &all_lit_occurrences[0] + s);
-    {const auto clend = clauses.cend();
-     for (auto i = clauses.cbegin(); i != clend; ++i) {
-       for (const Lit x : *i) {
-         const Var v = var(x); const Polarity p = sign(x);
-         *const_cast<ClauseP*>(varocc[v][p].e - count[v][p]--) =
-           const_cast<ClauseP>(&*i);
-       }
-     }
-    }
+    for_each_clause(clauses, [this, &count](const Clause& C, const Clause_ref R) {
+      for (const Lit x : C) {
+        const Var v = var(x); const Polarity p = sign(x);
+        *const_cast<Clause_ref*>(varocc[v][p].e - count[v][p]--) = R;
+      }
+    });
+  }
+#ifdef PARALLEL
+  // Copying L, with clause-references into F translated into G (a copy of F):
+  void copy(const LiteralOccurrences& L, [[maybe_unused]] const Clause_vec& F, [[maybe_unused]] Clause_vec& G) {
+    varocc = L.varocc;
+    all_lit_occurrences = L.all_lit_occurrences;
+    if (all_lit_occurrences.empty()) return;
+    const Clause_ref* const oldb = &L.all_lit_occurrences[0];
+    const Clause_ref* const newb = &all_lit_occurrences[0];
+    for (auto& V : varocc)
+      for (auto& O : V) { O.b = newb + (O.b - oldb); O.e = newb + (O.e - oldb); }
+# ifndef FLAT_CLAUSES
+    const Clause* const oldc = &F[0];
+    Clause* const newc = &G[0];
+    for (ClauseP& C : all_lit_occurrences) C = newc + (C - oldc);
+# endif
   }
+  friend void copy_formula(const Clauses&, const LiteralOccurrences&);
+#endif
   LiteralOccurrences(const LiteralOccurrences&) = delete;
   LiteralOccurrences(const LiteralOccurrences&&) = delete;
   friend void read_formula(const std::string&);
+#ifdef SOLVER_CORE
+  friend void load_formula(Var, const std::vector<std::vector<Lit_int>>&);
+#endif
 
 public :
   LiteralOccurrences() = default;
@@ -592,6 +999,14 @@ class Clauses {
   friend void read_formula_header(std::istream&);
   friend void add_a_clause_to_formula(const Lit_vec&, Count_vec&);
   friend void read_formula(const std::string&);
+#ifdef SOLVER_CORE
+  friend void load_formula(Var, const std::vector<std::vector<Lit_int>>&);
+#endif
+#ifdef PARALLEL
+  friend void copy_formula(const Clauses&, const LiteralOccurrences&);
+#else
+  friend std::uint64_t compute_formula_hash();
+#endif
 
   Clauses(const Clauses&) = delete;
   Clauses(Clauses&&) = delete;
@@ -599,14 +1014,15 @@ public :
   Clauses() = default;
   // for debugging:
   friend std::ostream& operator <<(std::ostream& out, const Clauses& F) {
-    for (const Clause& C : F.cl) out << C;
+    for_each_clause(F.cl, [&out](const Clause& C, Clause_ref){out << C;});
     return out;
   }
-} clauses; /* After construction no direct access anymore to variable "clauses"
+};
+TL Clauses clauses; /* After construction no direct access anymore to variable "clauses"
   (the clauses are handled via pointers to the elements of cl); "clauses" is
-  the only instance of class Clauses. */
+  the only instance of class Clauses (per thread). */
 
-LiteralOccurrences lits;
+TL LiteralOccurrences lits;
 // via lits[v][pos/neg] the sequence of literal-occurrences is obtained
 
 Count_clauses n_header_clauses, n_clauses, n_taut; // r_clauses see above
@@ -616,22 +1032,63 @@ Clause_index max_clause_length;
 
 typedef std::uint_fast64_t Count_statistics;
 
-Count_statistics n_nodes;
-Count_statistics n_backtracks;
-Count_statistics n_units;
+TL Count_statistics n_nodes;
+TL Count_statistics n_backtracks;
+TL Count_statistics n_units;
 
-  Count_statistics n_evaluations;
+TL Count_statistics n_evaluations;
 #ifndef FIRST_VARIABLE
-  Count_statistics n_proj, n_proj2zero, n_proj1zero,
+TL Count_statistics n_proj, n_proj2zero, n_proj1zero,
     n_nofirst, n_withfirst, n_nosecond, n_withsecond;
 
-Weight_t sum_first, sum_second, sumsq_first, sumsq_second,
+TL Weight_t sum_first, sum_second, sumsq_first, sumsq_second,
   min_first = std::numeric_limits<Weight_t>::infinity(),
   min_second = min_first,
   max_first = -std::numeric_limits<Weight_t>::infinity(),
   max_second = max_first;
 #endif
 
+#ifdef PHASE_STATISTICS
+/* The phases of dll(), each measured by the number of calls and the
+   cycles (the time-stamp-counter of the processor, otherwise the ticks of
+   std::chrono::steady_clock), inclusive of the nested phases (so that
+   assign_0 includes push_unit_clause): via PHASE(p) at the beginning of
+   the respective function, which is empty without PHASE_STATISTICS.
+*/
+enum class Phase {assign_0, assign_1, push_unit_clause, branching_literal,
+  reactivate_0, reactivate_1};
+constexpr unsigned n_phases = unsigned(Phase::reactivate_1) + 1;
+const std::array<std::string, n_phases> phase_names{"assign_0", "assign_1",
+  "push_unit_clause", "branching_literal", "reactivate_0", "reactivate_1"};
+typedef std::array<Count_statistics, n_phases> Phase_counts;
+TL Phase_counts phase_calls, phase_cycles;
+
+inline Count_statistics cycles() noexcept {
+# if defined __x86_64__ or defined __i386__
+  return __rdtsc();
+# else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+# endif
+}
+const std::string cycles_source =
+# if defined __x86_64__ or defined __i386__
+  "rdtsc";
+# else
+  "steady_clock";
+# endif
+template <Phase p>
+class Phase_timer {
+  const Count_statistics t0 = cycles();
+public :
+  ~Phase_timer() {
+    ++phase_calls[unsigned(p)]; phase_cycles[unsigned(p)] += cycles() - t0;
+  }
+};
+# define PHASE(p) const Phase_timer<Phase::p> phase_timer_
+#else
+# define PHASE(p)
+#endif
+
 #ifdef VAR_MARGINALS
 # define ALL_SOLUTIONS
 #endif
@@ -652,29 +1109,71 @@ Count_statistics n_pure_literals;
 #endif
 
 #ifdef TAU_ITERATION
-Count_statistics wtau_calls, tau_iterations;
+TL Count_statistics wtau_calls, tau_iterations;
 #endif
 
 #ifdef ALL_SOLUTIONS
+# ifdef GMP_COUNT
+#  ifdef COUNT_T
+#   error "GMP_COUNT and COUNT_T exclude each other."
+#  endif
+#  define COUNT_T mpz_class
+constexpr bool gmp_count = true;
+# else
+constexpr bool gmp_count = false;
+# endif
 # ifndef COUNT_T
 #  define COUNT_T std::uint_fast64_t
 # endif
 typedef COUNT_T Count_solutions;
 constexpr bool floating_count = std::is_floating_point<Count_solutions>::value;
-static_assert(floating_count or std::is_unsigned<Count_solutions>::value, "If using an integral type for counting, it must be unsigned.");
-constexpr Var count_bits = std::numeric_limits<Count_solutions>::digits;
-constexpr int count_digits = std::numeric_limits<Count_solutions>::digits10;
-template <typename CT, bool IS_FLOATING_TYPE> struct Pow2;
+constexpr bool builtin_count = not floating_count and not gmp_count;
+static_assert(not builtin_count or std::is_unsigned<Count_solutions>::value or std::is_same_v<Count_solutions, __uint128_t>, "If using an integral type for counting, it must be unsigned.");
+constexpr Var count_bits = gmp_count ? 0 : std::numeric_limits<Count_solutions>::digits;
+constexpr int count_digits = gmp_count ? 0 : std::numeric_limits<Count_solutions>::digits10;
+/* pow2(n) = 2^n: for the built-in integral types by shifting, otherwise
+   cached (per thread, computed when first needed), so that adding 2^n
+   at the leaves needs no computation resp. allocation: */
+template <typename CT, bool BUILTIN> struct Pow2;
 template <typename CT> struct Pow2<CT,true> {
-  constexpr CT operator()(const Var n) noexcept { return std::pow(2,n); }
-};
-template <typename CT> struct Pow2<CT,false> {
   constexpr CT operator()(const Var n) noexcept {
     return n<count_bits ? CT(1) << n : 0;
   }
 };
-Pow2<Count_solutions,floating_count> pow2;
-Count_solutions n_solutions;
+template <typename CT> struct Pow2<CT,false> {
+  static TL std::vector<CT> cache; // 0 means not computed yet
+  const CT& operator()(const Var n) {
+    if (n >= cache.size()) cache.resize(n+1);
+    CT& p = cache[n];
+    if (p == 0) {
+      if constexpr (floating_count) p = std::ldexp(CT(1), n);
+      else { p = 1; p <<= n; }
+    }
+    return p;
+  }
+};
+template <typename CT> TL std::vector<CT> Pow2<CT,false>::cache;
+Pow2<Count_solutions,builtin_count> pow2;
+TL Count_solutions n_solutions;
+
+// Reading a count as output by "<<" (throws in case of errors):
+template <class CT = Count_solutions>
+CT read_count(const std::string& s) {
+  if constexpr (floating_count) return std::stold(s);
+  else if constexpr (gmp_count) return CT(s);
+  else {
+    if (s.empty() or s.find_first_not_of("0123456789") != std::string::npos)
+      throw std::invalid_argument(s);
+    constexpr CT max = std::numeric_limits<CT>::max();
+    CT c = 0;
+    for (const char d : s) {
+      const unsigned digit = d - '0';
+      if (c > (max - digit) / 10) throw std::out_of_range(s);
+      c = 10 * c + digit;
+    }
+    return c;
+  }
+}
 #endif
 #ifdef VAR_MARGINALS
 typedef std::vector<Count_solutions> SolCount_vec;
@@ -688,7 +1187,7 @@ typedef std::int_fast64_t Rounds;
 static_assert(std::numeric_limits<Rounds>::digits <= std::numeric_limits<Count_clauses>::digits, "Problem with types Rounds versus Count_clauses.");
 
 // Sets n_vars and n_header_clauses, and calls
-// clauses.cl.resize(n_header_clauses); aborts via std::exit in case of
+// clauses.cl.resize(n_header_clauses) (not for FLAT_CLAUSES); aborts via std::exit in case of
 // input-errors:
 void read_formula_header(std::istream& f) {
   std::string line;
@@ -777,17 +1276,21 @@ void read_formula_header(std::istream& f) {
     errout << "Parameter number-of-clauses too big for round-counter.";
     std::exit(file_pline_error);
   }
+#ifndef FLAT_CLAUSES
   try { clauses.cl.resize(n_header_clauses); }
   catch (const std::bad_alloc&) {
     errout << "Allocation error for clauses-vector of size " <<
       n_header_clauses << " (the number-of-clauses).";
     std::exit(allocation_error);
   }
+#endif
 }
 
 // Returns false iff no (further) clause was found;
-// reference-parameter C is empty iff a tautological clause was found:
-inline bool read_a_clause_from_file(std::istream& f, Lit_vec& C) {
+// reference-parameter C is empty iff a tautological clause was found;
+// Stream is std::istream or TokenStream (below):
+template <class Stream>
+inline bool read_a_clause_from_file(Stream& f, Lit_vec& C) {
   {static std::vector<Rounds> literal_table(n_vars+1,0);
    static Rounds round = 0;
    Lit x;
@@ -853,14 +1356,32 @@ inline void add_a_clause_to_formula(const Lit_vec& D, Count_vec& count) {
     errout << "More than " << n_header_clauses << " clauses, contradicting cnf-header.";
     std::exit(number_clauses_error);
   }
+#ifndef FLAT_CLAUSES
   auto& C = clauses.cl[n_clauses];
   C.length_ = n;
   C.b = new Lit[n];
   C.e = C.b + n;
+  Lit* const b = const_cast<Lit*>(C.b);
+#else
+  auto& A = clauses.cl;
+  const auto start = A.size();
+  if (Count_clauses(start) + Clause::header_words + n > std::numeric_limits<Clause_index>::max()) {
+    errout << "Too many literal occurrences for the arena of FLAT_CLAUSES.";
+    std::exit(allocation_error);
+  }
+  try { A.resize(start + Clause::header_words + n); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error for the arena of FLAT_CLAUSES.";
+    std::exit(allocation_error);
+  }
+  Clause& C = *new (&A[start]) Clause;
+  C.size_ = C.length_ = n;
+  Lit* const b = const_cast<Lit*>(C.begin());
+#endif
   if (n > max_clause_length) max_clause_length = n;
   for (Clause_index i = 0; i < n; ++i) {
     const Lit x = D[i];
-    const_cast<Lit*>(C.b)[i] = x;
+    new (b + i) Lit(x);
     const Var v = var(x);
     ++count[v][sign(x)];
     max_occ_var = std::max(v, max_occ_var);
@@ -869,6 +1390,181 @@ inline void add_a_clause_to_formula(const Lit_vec& D, Count_vec& count) {
   n_lit_occurrences += n;
 }
 
+/* Reading the clauses from a memory-mapped file:
+
+    - The part up to and including the p-line is handed (as a string-stream)
+      to read_formula_header.
+    - The rest is split into (at most) n_read_threads chunks, at whitespace,
+      which are tokenised in parallel into sequences of integers (imitating
+      "std::istream >> Lit_int", including the failure-cases).
+    - The resulting tokens are read sequentially via TokenStream, which
+      imitates the states of std::istream, so that read_a_clause_from_file
+      (and add_a_clause_to_formula) processes them exactly as for
+      stream-input (thus with the same error-behaviour).
+
+   With STREAM_READING defined, only stream-input is used.
+*/
+
+unsigned n_read_threads = std::max(1u, std::thread::hardware_concurrency());
+// The minimal size of a chunk (for tokenising in its own thread):
+constexpr std::size_t min_chunk_size = 1 << 20;
+
+// Wall-clock durations of the reading-phases (in sec):
+typedef std::chrono::time_point<std::chrono::high_resolution_clock> WTime_point;
+typedef std::chrono::duration<long double> Duration;
+Duration parsing_time, clauses_time, occurrences_time, initialisation_time;
+// The number of threads used for tokenising:
+unsigned n_reading_threads = 1;
+
+// Read-only memory-mapping of a regular file (otherwise converts to false):
+class MappedFile {
+  int fd = -1;
+  const char* b = nullptr;
+  std::size_t size_ = 0;
+  bool valid = false;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator =(const MappedFile&) = delete;
+public :
+  explicit MappedFile(const std::string& f) noexcept {
+#ifndef STREAM_READING
+    if (f == "-cin") return;
+    fd = ::open(f.c_str(), O_RDONLY);
+    if (fd == -1) return;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 or not S_ISREG(st.st_mode)) return;
+    size_ = st.st_size;
+    if (size_ != 0) {
+      void* const p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) return;
+      ::madvise(p, size_, MADV_SEQUENTIAL | MADV_WILLNEED);
+      b = static_cast<const char*>(p);
+    }
+    valid = true;
+#endif
+  }
+  ~MappedFile() {
+    if (b) ::munmap(const_cast<char*>(b), size_);
+    if (fd != -1) ::close(fd);
+  }
+  explicit operator bool() const noexcept { return valid; }
+  const char* begin() const noexcept { return b; }
+  const char* end() const noexcept { return b + size_; }
+};
+
+// The end of the header (all lines up to and including the first line not
+// starting with "c"):
+const char* header_end(const char* p, const char* const end) noexcept {
+  while (p != end) {
+    const bool comment = *p == 'c';
+    while (p != end and *p++ != '\n');
+    if (not comment) break;
+  }
+  return p;
+}
+
+// The whitespace-characters of the C-locale:
+inline constexpr bool is_space(const char c) noexcept {
+  return c == ' ' or c == '\n' or c == '\t' or c == '\r' or c == '\v' or c == '\f';
+}
+
+/* The tokens of a chunk: the literals as integers, and whether reading
+   failed after them (invalid character or number too big); at_eof means
+   that the last token (successful or not) reached the end of the file:
+*/
+struct Tokens {
+  std::vector<Lit_int> lits;
+  bool failure = false, at_eof = false;
+};
+
+// Tokenising [p, end), where fend is the end of the file:
+void tokenise(const char* p, const char* const end, const char* const fend, Tokens& T) {
+  typedef std::make_unsigned_t<Lit_int> UInt;
+  constexpr UInt max_pos = max_lit, max_neg = max_pos + 1;
+  T.lits.reserve((end - p) / 4);
+  while (true) {
+    while (p != end and is_space(*p)) ++p;
+    if (p == end) return;
+    const bool neg = *p == '-';
+    if (neg or *p == '+') ++p;
+    const UInt bound = neg ? max_neg : max_pos;
+    UInt val = 0;
+    bool digits = false, overflow = false;
+    for (; p != end and *p >= '0' and *p <= '9'; ++p) {
+      digits = true;
+      const UInt d = *p - '0';
+      if (val > (bound - d) / 10) overflow = true;
+      else val = 10 * val + d;
+    }
+    if (not digits or overflow) {
+      T.failure = true; T.at_eof = p == fend; return;
+    }
+    T.lits.push_back(neg ? Lit_int(UInt(0) - val) : Lit_int(val));
+    if (p == fend) { T.at_eof = true; return; }
+  }
+}
+
+// Reading the sequence of chunks like a std::istream:
+class TokenStream {
+  const std::vector<Tokens>& T;
+  std::size_t c = 0, i = 0;
+  bool eof_ = false, fail_ = false;
+public :
+  explicit TokenStream(const std::vector<Tokens>& T) noexcept : T(T) {}
+  TokenStream& operator >>(Lit& x) noexcept {
+    if (eof_ or fail_) { fail_ = true; return *this; }
+    while (c != T.size() and i == T[c].lits.size()) {
+      if (T[c].failure) {
+        x = Lit(0); fail_ = true; eof_ = T[c].at_eof; return *this;
+      }
+      ++c; i = 0;
+    }
+    if (c == T.size()) { eof_ = fail_ = true; return *this; }
+    x = Lit(T[c].lits[i++]);
+    if (i == T[c].lits.size() and T[c].at_eof and not T[c].failure)
+      eof_ = true;
+    return *this;
+  }
+  bool eof() const noexcept { return eof_; }
+  bool good() const noexcept { return not eof_ and not fail_; }
+  explicit operator bool() const noexcept { return not fail_; }
+};
+
+// Tokenising [b, e) with at most n_read_threads threads:
+std::vector<Tokens> tokenise(const char* const b, const char* const e) {
+  const std::size_t size = e - b;
+  const unsigned n = std::max<std::size_t>(1,
+    std::min<std::size_t>(n_read_threads, size / min_chunk_size));
+  std::vector<const char*> bounds{b};
+  for (unsigned i = 1; i < n; ++i) {
+    const char* p = std::max(b + i * (size / n), bounds.back());
+    while (p != e and not is_space(*p)) ++p;
+    bounds.push_back(p);
+  }
+  bounds.push_back(e);
+  std::vector<Tokens> T(n);
+  {std::vector<std::thread> workers;
+   workers.reserve(n-1);
+   for (unsigned i = 1; i < n; ++i)
+     workers.emplace_back(
+       [&T,&bounds,e,i]{tokenise(bounds[i], bounds[i+1], e, T[i]);});
+   tokenise(bounds[0], bounds[1], e, T[0]);
+   for (auto& w : workers) w.join();
+  }
+  n_reading_threads = n;
+  return T;
+}
+
+Count_vec allocate_count() {
+  Count_vec count;
+  try { count.resize(n_vars+1); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error for counting-vector of size " <<
+      n_vars << " (the maximal-variable-index).";
+    std::exit(allocation_error);
+  }
+  return count;
+}
+
 void read_formula(const std::string& filename) {
   class Input {
     const std::string& f;
@@ -886,19 +1582,81 @@ void read_formula(const std::string& filename) {
     ~Input() { if (del) delete p; }
     std::istream& operator *() const { return *p; }
   };
-  const Input in(filename);
-  read_formula_header(*in);
+  const auto now = std::chrono::high_resolution_clock::now;
+  const WTime_point t0 = now();
   Count_vec count;
-  try { count.resize(n_vars+1); }
+  if (const MappedFile m(filename); m) {
+    const char* const h = header_end(m.begin(), m.end());
+    {std::istringstream header(std::string(m.begin(), h));
+     read_formula_header(header);
+    }
+    count = allocate_count();
+    const auto T = tokenise(h, m.end());
+    const WTime_point t1 = now();
+    parsing_time = t1 - t0;
+    TokenStream in(T);
+    Lit_vec C;
+    while (read_a_clause_from_file(in,C)) add_a_clause_to_formula(C,count);
+    clauses_time = now() - t1;
+  }
+  else {
+    const Input in(filename);
+    read_formula_header(*in);
+    count = allocate_count();
+    Lit_vec C;
+    while (read_a_clause_from_file(*in,C)) add_a_clause_to_formula(C,count);
+    parsing_time = now() - t0;
+  }
+  if (not (r_clauses = n_clauses)) return;
+#ifdef FLAT_CLAUSES
+  construct_clauses(clauses.cl);
+  clause_arena = clauses.cl.data();
+#endif
+  const WTime_point t2 = now();
+  try { lits.init(n_lit_occurrences, max_occ_var, clauses.cl, count); }
   catch (const std::bad_alloc&) {
-    errout << "Allocation error for counting-vector of size " <<
-      n_vars << " (the maximal-variable-index).";
+    errout << "Allocation error for ClauseP-vector of size " <<
+       n_lit_occurrences << " (the number of literal occurrences).";
+    std::exit(allocation_error);
+  }
+  occurrences_time = now() - t2;
+}
+
+#ifdef SOLVER_CORE
+/* Loading the formula with n variables from F (instead of reading it from
+   a file), where the clauses contain no repeated literals and are not
+   tautological (as for the Dimacs-input of the OKlibrary); empty clauses
+   and unit-clauses are skipped (they have to be handled by the caller): */
+void load_formula(const Var n, const std::vector<std::vector<Lit_int>>& F) {
+  if (not valid(n)) {
+    errout << "Parameter maximal-variable-index n=" << n <<
+      " is too big for numeric_limits<Lit_int>::max=" << max_lit << ".";
+    std::exit(num_vars_error);
+  }
+  n_vars = n;
+  n_header_clauses = 0;
+  for (const auto& C : F) n_header_clauses += C.size() >= 2;
+#ifndef FLAT_CLAUSES
+  try { clauses.cl.resize(n_header_clauses); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error for clauses-vector of size " <<
+      n_header_clauses << " (the number-of-clauses).";
     std::exit(allocation_error);
   }
-  {Lit_vec C;
-   while (read_a_clause_from_file(*in,C)) add_a_clause_to_formula(C,count);
+#endif
+  Count_vec count = allocate_count();
+  Lit_vec D;
+  for (const auto& C : F) {
+    if (C.size() < 2) continue;
+    D.clear();
+    for (const Lit_int x : C) D.push_back(Lit(x));
+    add_a_clause_to_formula(D, count);
   }
   if (not (r_clauses = n_clauses)) return;
+#ifdef FLAT_CLAUSES
+  construct_clauses(clauses.cl);
+  clause_arena = clauses.cl.data();
+#endif
   try { lits.init(n_lit_occurrences, max_occ_var, clauses.cl, count); }
   catch (const std::bad_alloc&) {
     errout << "Allocation error for ClauseP-vector of size " <<
@@ -906,6 +1664,7 @@ void read_formula(const std::string& filename) {
     std::exit(allocation_error);
   }
 }
+#endif
 
 
 // --- Data structures for partial assignments and unit-clause propagation ---
@@ -916,7 +1675,7 @@ void read_formula(const std::string& filename) {
 class Pass {
   Lit_vec pass;
   void init() { pass.resize(max_occ_var+1); }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   Lit operator[] (const Var v) const noexcept { return pass[v]; }
   Lit& operator[] (const Var v) noexcept { return pass[v]; }
@@ -933,12 +1692,12 @@ public :
     return out << "0" << std::endl;
   }
 };
-Pass pass;
+TL Pass pass;
 #ifdef VAR_MARGINALS
 class VarMarginals {
   SolCount_vec sc;
   void init() { sc.resize(n_vars+1); }
-  friend void initialisation();
+  friend void thread_initialisation();
   friend DLL_return_t dll0();
 public :
   Count_solutions operator[] (const Var v) const noexcept { return sc[v]; }
@@ -950,7 +1709,7 @@ public :
     return out << std::endl;
   }
 };
-VarMarginals marginals;
+TL VarMarginals marginals;
 #endif
 
 class ChangeManagement {
@@ -963,18 +1722,20 @@ class ChangeManagement {
     changes.resize(s);
     begin = next = &*changes.begin();
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   void start_new() noexcept { *(next++) = nullptr; }
   void push(const ClauseP C) noexcept { *(next++) = C; }
   void reactivate_0() noexcept {
+    PHASE(reactivate_0);
     while (const ClauseP C = *(--next)) C->increment();
   }
   void reactivate_1() noexcept {
+    PHASE(reactivate_1);
     while (const ClauseP C = *(--next)) C->activate();
   }
 };
-ChangeManagement changes;
+TL ChangeManagement changes;
 
 /* Buffers for unit-clauses (to be processed), either
     - first-in first-out (BFS), or
@@ -987,16 +1748,16 @@ ChangeManagement changes;
 #if UCP_STRATEGY == 0 // BFS
 class Unit_stack {
   typedef Lit_vec stack_t;
-  static stack_t stack;
-  static Lit* end_;
-  static Lit* open_;
+  static TL stack_t stack;
+  static TL Lit* end_;
+  static TL Lit* open_;
   const Lit* const begin_;
   static void init() {
     stack.resize(max_occ_var);
     assert(max_occ_var);
     end_ = &stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void push(const Lit x) noexcept {
     assert(end_ - &stack[0] < max_occ_var);
@@ -1016,19 +1777,19 @@ public :
   const Lit* begin() const noexcept { return begin_; }
   static const Lit* end() noexcept { return end_; }
 };
-Unit_stack::stack_t Unit_stack::stack;
-Lit* Unit_stack::end_;
-Lit* Unit_stack::open_;
+TL Unit_stack::stack_t Unit_stack::stack;
+TL Lit* Unit_stack::end_;
+TL Lit* Unit_stack::open_;
 
 #else // DFS
 
 class Unit_stack {
   typedef Lit_vec stack_t;
-  static stack_t main_stack;
-  static stack_t input_stack;
-  static Lit* begin_input;
-  static Lit* end_input;
-  static Lit* end_main;
+  static TL stack_t main_stack;
+  static TL stack_t input_stack;
+  static TL Lit* begin_input;
+  static TL Lit* end_input;
+  static TL Lit* end_main;
   const Lit* const begin_main;
   static Lit push_main(const Lit x) noexcept {
     assert(end_main - &main_stack[0] < max_occ_var);
@@ -1045,7 +1806,7 @@ class Unit_stack {
     end_main = &main_stack[0];
     begin_input = end_input = &input_stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void push(const Lit x) noexcept {
     assert(end_input - begin_input < max_occ_var);
@@ -1064,11 +1825,11 @@ public :
   const Lit* begin() const noexcept { return begin_main; }
   static const Lit* end() noexcept { return end_main; }
 };
-Unit_stack::stack_t Unit_stack::main_stack;
-Unit_stack::stack_t Unit_stack::input_stack;
-Lit* Unit_stack::begin_input;
-Lit* Unit_stack::end_input;
-Lit* Unit_stack::end_main;
+TL Unit_stack::stack_t Unit_stack::main_stack;
+TL Unit_stack::stack_t Unit_stack::input_stack;
+TL Lit* Unit_stack::begin_input;
+TL Lit* Unit_stack::end_input;
+TL Lit* Unit_stack::end_main;
 #endif
 
 class Push_unit_clause {
@@ -1076,6 +1837,7 @@ class Push_unit_clause {
 public :
   // returns false iff contradiction found:
   bool operator() (const Clause& C) noexcept {
+    PHASE(push_unit_clause);
     assert(C.length() == 1);
     assert(not contradiction_);
     for (const Lit y : C) {
@@ -1095,7 +1857,7 @@ public :
     else return false;
   }
 };
-Push_unit_clause push_unit_clause;
+TL Push_unit_clause push_unit_clause;
 
 #ifdef PURE_LITERALS
 void assign_1(Lit) noexcept;
@@ -1116,7 +1878,7 @@ class PureLiterals {
     assert(max_occ_var);
     end_ = &stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void clear() noexcept { new_begin = end_; }
   static bool set(const Var v, const Polarity s) noexcept {
@@ -1287,26 +2049,231 @@ public :
 constexpr Weight_t Weights::min_weight;
 Weights weight;
 
+#ifdef INCREMENTAL_SCORES
+/* The score of a literal x is the sum of the weights of the current lengths
+   of all clauses containing x (satisfied clauses have length 0, with
+   weight 0), which is the sum computed by branching_literal() without
+   INCREMENTAL_SCORES. The scores are kept up-to-date by the members of
+   Clause which change the length (and are thus rolled back together with
+   the lengths by ChangeManagement), so that branching_literal() only needs
+   time O(n).
+   To avoid rounding-drift, the scores are computed exactly, in fixed-point
+   arithmetic: the weights are rounded to multiples of 2^-32 (at least
+   2^-32), and the sums are unsigned 64-bit integers. So the weight-sums
+   differ slightly from the floating-point sums, and the branching can
+   differ in rare cases (ties).
+*/
+class Scores {
+  typedef std::uint64_t score_t;
+  static constexpr Weight_t scale = 4294967296.0; // 2^32
+  static constexpr Weight_t unit = 1 / scale;
+  static std::vector<score_t> fweight; // the weights in fixed-point
+  static TL std::vector<std::array<score_t,2>> score;
+
+  static score_t fixed(const Weight_t w) noexcept {
+    if (w == 0) return 0;
+    return std::max(score_t(1), score_t(std::llround(w * scale)));
+  }
+  static void init_weights() {
+    fweight.resize(max_clause_length+1);
+    for (Clause_index i = 2; i <= max_clause_length; ++i)
+      fweight[i] = fixed(weight[i]);
+  }
+  // Computing the scores from lits (for the current thread):
+  static void init() {
+    score.assign(max_occ_var+1, {0,0});
+    for (Var v = 1; v <= max_occ_var; ++v)
+      for (const Polarity p : {neg, pos})
+        for (const auto C : lits[v][p]) score[v][p] += fweight[C->length()];
+  }
+  friend void initialisation();
+#ifdef PARALLEL
+  friend void copy_formula(const Clauses&, const LiteralOccurrences&);
+#endif
+  friend void update_scores(const Clause&, Clause_index, Clause_index) noexcept;
+public :
+  static Weight_t value(const Var v, const Polarity p) noexcept {
+    return score[v][p] * unit;
+  }
+};
+std::vector<Scores::score_t> Scores::fweight;
+TL std::vector<std::array<Scores::score_t,2>> Scores::score;
+
+inline void update_scores(const Clause& C, const Clause_index l0, const Clause_index l1) noexcept {
+  // the difference modulo 2^64:
+  const Scores::score_t d = Scores::fweight[l1] - Scores::fweight[l0];
+  for (const Lit x : C) Scores::score[var(x)][sign(x)] += d;
+}
+#endif
+
+
+// --- Data structures for parallel search ---
+
+#ifdef PARALLEL
+unsigned n_threads = std::max(1u, std::thread::hardware_concurrency());
+TL Count_statistics n_donations; // donated by the current thread
+TL Count_statistics n_replayed; // decisions replayed by the current thread
+std::mutex output_mutex; // for the output of solutions
+
+/* The pool of jobs (each the sequence of decisions from the root to the
+   root of the job), together with the termination-logic:
+    - get(job) blocks until a job is available, and returns false iff all
+      workers are idle (and no job is left), or the search was halted;
+    - hungry() is true iff there are idle workers not served by a job;
+    - halt() stops the whole search (returns true iff it is the first call).
+*/
+class WorkPool {
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<Lit_vec> jobs;
+  unsigned workers = 1, idle = 0;
+  bool finished = false;
+  std::atomic<int> demand{0};
+  std::atomic<bool> stop{false};
+  void update() noexcept {
+    demand.store(finished ? 0 : int(idle) - int(jobs.size()),
+                 std::memory_order_relaxed);
+  }
+public :
+  void init(const unsigned n) noexcept { workers = n; }
+  bool hungry() const noexcept {
+    return demand.load(std::memory_order_relaxed) > 0;
+  }
+  bool stopped() const noexcept {
+    return stop.load(std::memory_order_relaxed);
+  }
+  void put(Lit_vec&& job) {
+    {const std::lock_guard lock(m); jobs.push_back(std::move(job)); update();}
+    cv.notify_one();
+  }
+  bool get(Lit_vec& job) {
+    std::unique_lock lock(m);
+    ++idle;
+    if (jobs.empty() and idle == workers) finished = true;
+    update();
+    if (finished) { cv.notify_all(); return false; }
+    cv.wait(lock, [this]{return finished or not jobs.empty();});
+    if (finished) return false;
+    job = std::move(jobs.front()); jobs.pop_front();
+    --idle; update();
+    return true;
+  }
+  bool halt() {
+    const bool first = not stop.exchange(true);
+    {const std::lock_guard lock(m); finished = true; update();}
+    cv.notify_all();
+    return first;
+  }
+};
+WorkPool pool;
+#endif
+
+/* The decision path of the current thread: the decisions (the literals set
+   to true by branching) from the root to the current node, each with the
+   information whether the second branch is still pending (to be explored
+   by the current thread); used for donating jobs and for checkpoints.
+*/
+class Path {
+public :
+  struct Decision { Lit x; bool pending; };
+private :
+  typedef std::vector<Decision> stack_t;
+  static TL stack_t stack;
+  static TL Decision* end_;
+  static void init() {
+    stack.resize(max_occ_var+1);
+    end_ = &stack[0];
+  }
+  friend void thread_initialisation();
+public :
+  static Decision* push(const Lit x, const bool pending) noexcept {
+    assert(end_ - &stack[0] <= max_occ_var);
+    *end_ = {x, pending};
+    return end_++;
+  }
+  static void pop() noexcept { assert(end_ != &stack[0]); --end_; }
+  static const Decision* begin() noexcept { return &stack[0]; }
+  static const Decision* end() noexcept { return end_; }
+#ifdef PARALLEL
+  // Donating the first pending second branch (if there is one) to the pool:
+  static void donate() {
+    for (Decision* p = &stack[0]; p != end_; ++p)
+      if (p->pending) {
+        p->pending = false;
+        Lit_vec job; job.reserve(p - &stack[0] + 1);
+        for (const Decision* q = &stack[0]; q != p; ++q) job.push_back(q->x);
+        job.push_back(-p->x);
+        pool.put(std::move(job));
+        ++n_donations;
+        return;
+      }
+  }
+#endif
+};
+TL Path::stack_t Path::stack;
+TL Path::Decision* Path::end_;
+
+// A branching on x, with the second branch -x pending:
+class Decision_level {
+  Path::Decision* const d;
+public :
+  explicit Decision_level(const Lit x) noexcept : d(Path::push(x, true)) {}
+  ~Decision_level() { Path::pop(); }
+  // True iff the second branch is (still) to be explored by this thread:
+  bool second() noexcept {
+    if (not d->pending) return false;
+    d->x = -d->x; d->pending = false;
+    return true;
+  }
+};
+
 
 // --- Initialisation of algorithmic data structures ---
 
-void initialisation() {
+// The data used only by the current thread:
+void thread_initialisation() {
   pass.init();
 #ifdef VAR_MARGINALS
   marginals.init();
 #endif
   changes.init();
   Unit_stack::init();
-  weight.init();
 #ifdef PURE_LITERALS
   PureLiterals::init();
+#endif
+  Path::init();
+}
+
+void initialisation() {
+  thread_initialisation();
+  weight.init();
+#ifdef INCREMENTAL_SCORES
+  Scores::init_weights();
+  Scores::init();
 #endif
 }
 
+#ifdef PARALLEL
+// The thread-local copy of the (original) formula F with occurrences L:
+void copy_formula(const Clauses& F, const LiteralOccurrences& L) {
+  clauses.cl = F.cl;
+#ifdef FLAT_CLAUSES
+  construct_clauses(clauses.cl);
+  clause_arena = clauses.cl.data();
+#endif
+  lits.copy(L, F.cl, clauses.cl);
+  r_clauses = n_clauses;
+#ifdef INCREMENTAL_SCORES
+  Scores::init();
+#endif
+}
+#endif
+
 
 // --- Assignments to variables ---
 
 inline void assign_0(const Lit x) noexcept {
+  PHASE(assign_0);
   assert(x);
   const Var v = var(x);
   assert(v <= max_occ_var);
@@ -1321,6 +2288,7 @@ inline void assign_0(const Lit x) noexcept {
 }
 
 inline void assign_1(const Lit x) noexcept {
+  PHASE(assign_1);
   assert(x);
   const Var v = var(x);
   assert(v <= max_occ_var);
@@ -1479,6 +2447,7 @@ typedef Branching_product Best_branching;
 
 #ifndef FIRST_VARIABLE
 inline Lit branching_literal() noexcept {
+  PHASE(branching_literal);
   Best_branching br;
 # ifdef PURE_LITERALS
   PureLiterals::clear(); changes.start_new();
@@ -1486,11 +2455,14 @@ inline Lit branching_literal() noexcept {
   const auto nvar = max_occ_var+1;
   for (Var v = 1; v != nvar; ++v) {
     if (pass[v]) continue;
+# ifdef INCREMENTAL_SCORES
+    Weight_t ps = Scores::value(v, pos);
+# elif ! defined LAMBDA
     const auto Occ = lits[v];
-# ifndef LAMBDA
     Weight_t ps = 0;
     for (const auto C : Occ[pos]) ps += weight[C->length()];
 # else
+    const auto Occ = lits[v];
     Weight_t ps = 0, sns = 0;
     for (const auto C : Occ[pos]) {
       const auto l = C->length();
@@ -1500,7 +2472,9 @@ inline Lit branching_literal() noexcept {
 # ifdef PURE_LITERALS
     if (ps == 0) {if (PureLiterals::set(v,neg)) return 0_l; else continue;}
 # endif
-# ifndef LAMBDA
+# ifdef INCREMENTAL_SCORES
+    Weight_t ns = Scores::value(v, neg);
+# elif ! defined LAMBDA
     Weight_t ns = 0;
     for (const auto C : Occ[neg]) ns += weight[C->length()];
 # else
@@ -1541,6 +2515,7 @@ inline Lit branching_literal() noexcept {
 }
 #else
 inline Lit branching_literal() noexcept {
+  PHASE(branching_literal);
   ++n_evaluations;
   PureLiterals::clear(); changes.start_new();
   const auto nvar = max_occ_var+1;
@@ -1561,12 +2536,194 @@ inline Lit branching_literal() noexcept {
 
 
 
+// --- Asynchronous output of solutions ---
+
+#ifdef ALL_SOLUTIONS
+/* If started (by main, if the solutions are output, but not to the same
+   stream as the statistics, and no splitting is done), then add_solutions()
+   only copies the assigned literals into a lock-free
+   single-producer-single-consumer ring-buffer (each solution terminated by
+   the singular literal), while a writer-thread formats the solutions (as
+   usual "v x1 ... xk 0") and writes them in blocks (without flushing for
+   every solution); with PARALLEL the producers are serialised by
+   output_mutex. sync() waits until all solutions pushed are written (and
+   flushes), finish() terminates the writer-thread.
+*/
+class SolutionWriter {
+  static constexpr std::uint64_t finished = std::uint64_t(1) << 63;
+  static constexpr std::size_t block = 1 << 16;
+  std::ostream* out = nullptr;
+  std::vector<Lit> ring;
+  std::uint64_t mask;
+  // Positions (only increasing) of the ring-buffer:
+  std::atomic<std::uint64_t> head = 0, // pushed (plus finished at the end)
+    tail = 0, // formatted
+    written = 0; // written to *out
+  std::uint64_t cached_tail = 0; // only used by the producer
+  std::thread writer;
+
+  void run() {
+    std::vector<char> buf(block + 32);
+    char* const end = buf.data() + buf.size();
+    char* pos = buf.data();
+    const auto write = [&]{
+      out->write(buf.data(), pos - buf.data()); pos = buf.data();
+    };
+    bool line_start = true;
+    for (std::uint64_t t = 0;;) {
+      std::uint64_t h = head.load(std::memory_order_acquire);
+      const bool fin = h & finished; h &= ~finished;
+      if (t == h) {
+        write();
+        written.store(t, std::memory_order_release); written.notify_all();
+        if (fin) return;
+        head.wait(t, std::memory_order_acquire);
+        continue;
+      }
+      for (; t != h; ++t) {
+        if (line_start) { *pos++ = 'v'; *pos++ = ' '; line_start = false; }
+        const Lit x = ring[t & mask];
+        if (x) {
+          if (sign(x) == neg) *pos++ = '-';
+          pos = std::to_chars(pos, end, var(x)).ptr;
+          *pos++ = ' ';
+        }
+        else { *pos++ = '0'; *pos++ = '\n'; line_start = true; }
+        if (pos - buf.data() >= std::ptrdiff_t(block)) {
+          write();
+          tail.store(t+1, std::memory_order_release); tail.notify_one();
+        }
+      }
+      tail.store(t, std::memory_order_release); tail.notify_one();
+    }
+  }
+
+public :
+  bool active() const noexcept { return out; }
+
+  void start(const Output& o) {
+    if (not o.active()) return;
+    out = o.p;
+    ring.resize(std::bit_ceil(std::max<std::size_t>(1 << 20,
+                                                    2 * (max_occ_var+1))));
+    mask = ring.size() - 1;
+    // SIGINT, SIGUSR1, SIGUSR2, SIGALRM only for the main thread:
+    sigset_t sigs, old_sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT); sigaddset(&sigs, SIGUSR1);
+    sigaddset(&sigs, SIGUSR2); sigaddset(&sigs, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &sigs, &old_sigs);
+    writer = std::thread([this]{run();});
+    pthread_sigmask(SIG_SETMASK, &old_sigs, nullptr);
+  }
+
+  // Waits if the ring-buffer has no space for another solution:
+  void push(const Pass& p) noexcept {
+    const std::uint64_t h = head.load(std::memory_order_relaxed) & ~finished;
+    while (h + p.size() - cached_tail > ring.size()) {
+      cached_tail = tail.load(std::memory_order_acquire);
+      if (h + p.size() - cached_tail > ring.size())
+        tail.wait(cached_tail, std::memory_order_acquire);
+    }
+    std::uint64_t i = h;
+    for (Var v = 1; v < p.size(); ++v) if (p[v]) ring[i++ & mask] = p[v];
+    ring[i++ & mask] = Lit();
+    head.fetch_add(i - h, std::memory_order_release); head.notify_one();
+  }
+
+  void sync() {
+    if (not writer.joinable()) return;
+    const std::uint64_t h = head.load(std::memory_order_relaxed) & ~finished;
+    for (std::uint64_t w; (w = written.load(std::memory_order_acquire)) != h;)
+      written.wait(w, std::memory_order_acquire);
+    out->flush();
+  }
+  void finish() {
+    if (not writer.joinable()) return;
+    head.fetch_or(finished, std::memory_order_release); head.notify_one();
+    writer.join();
+    out->flush();
+  }
+  ~SolutionWriter() { finish(); }
+};
+SolutionWriter solwriter;
+#endif
+
+
 // --- The main (backtracking) algorithm ---
 
 Pass sat_pass;
 
+#ifdef ALL_SOLUTIONS
+# ifndef PARALLEL
+bool found_solutions; // for checkpoints (n_solutions may be 0 modulo 2^k)
+# endif
+// Outputting and counting the solutions given by pass (satisfying F):
+inline void add_solutions() {
+# ifndef PARALLEL
+  if (solwriter.active()) solwriter.push(pass);
+  else if (solout.active()) solout << pass;
+  found_solutions = true;
+# else
+  if (solout.active()) {
+    const std::lock_guard lock(output_mutex);
+    if (solwriter.active()) solwriter.push(pass); else solout << pass;
+  }
+# endif
+# ifndef VAR_MARGINALS
+  n_solutions += pow2(n_vars - pass.n());
+# else
+  const Var rem_n = n_vars - pass.n();
+  assert(marginals.size() == n_vars+1);
+  if (rem_n == 0) {
+    ++n_solutions;
+    for (Var i=1; i <= n_vars; ++i)
+      marginals[i] += sign(pass[i]) == Polarity::pos;
+  } else {
+    const auto& total = pow2(rem_n);
+    n_solutions += total;
+    const Count_solutions totald2 = total / 2;
+    for (Var i=1; i <= n_vars; ++i) {
+      const Lit x = pass[i];
+      Count_solutions& m = marginals[i];
+      if (not x) m += totald2;
+      else if (sign(x) == Polarity::pos) m += total;
+    }
+  }
+# endif
+}
+#endif
+
+// Checkpoints (see "Checkpoints" below; only without PARALLEL):
+std::string checkpoint_file, resume_file;
+unsigned checkpoint_interval = 3600; // seconds
+Count_statistics n_checkpoints;
+#ifndef PARALLEL
+// Set by signals, the checkpoint is then written at the next node:
+enum Checkpoint_request { no_request = 0, checkpoint = 1, checkpoint_abort = 2 };
+volatile std::sig_atomic_t checkpoint_request = no_request;
+void write_checkpoint();
+#endif
+/* Set by SIGINT (see abortion below); the run is then aborted on the main
+   path via abort_run (the output and solwriter.finish() are not
+   async-signal-safe): without PARALLEL at the next node, with PARALLEL the
+   workers halt the pool, and after their termination the main thread
+   aborts the run:
+*/
+volatile std::sig_atomic_t abort_request = false;
+[[noreturn]] void abort_run();
+
 DLL_return_t dll(const Lit x) {
+#ifndef PARALLEL
+  if (abort_request) abort_run();
+  if (checkpoint_request) write_checkpoint();
+#endif
   ++n_nodes;
+#ifdef PARALLEL
+  if (abort_request and not pool.stopped()) pool.halt();
+  if (pool.stopped()) return false;
+  if (pool.hungry()) Path::donate();
+#endif
   assert(x);
   DLL_return_t result = false;
 
@@ -1584,31 +2741,13 @@ DLL_return_t dll(const Lit x) {
   for (const Lit y : unit_stack) assign_1(y);
   if (not r_clauses) {
 #ifdef ALL_SOLUTIONS
-    solout << pass;
+    add_solutions();
     result = true;
-# ifndef VAR_MARGINALS
-    n_solutions += pow2(n_vars - pass.n());
-# else
-    const Var rem_n = n_vars - pass.n();
-    assert(marginals.size() == n_vars+1);
-    if (rem_n == 0) {
-      ++n_solutions;
-      for (Var i=1; i <= n_vars; ++i)
-        marginals[i] += sign(pass[i]) == Polarity::pos;
-    } else {
-      const auto total = pow2(rem_n);
-      n_solutions += total;
-      const auto totald2 = total / 2;
-      for (Var i=1; i <= n_vars; ++i) {
-        const Lit x = pass[i];
-        Count_solutions& m = marginals[i];
-        if (not x) m += totald2;
-        else if (sign(x) == Polarity::pos) m += total;
-      }
-    }
-# endif
     goto only_units;
 #else
+# ifdef PARALLEL
+    if (pool.halt())
+# endif
     sat_pass = pass;
     return true;
 #endif
@@ -1619,14 +2758,19 @@ DLL_return_t dll(const Lit x) {
    const PureLiterals pure_stack;
    if (not r_clauses) {sat_pass = pass; return true;}
 #endif
+   Decision_level level(y);
 #ifdef ALL_SOLUTIONS
    result = dll(y);
-   ++n_backtracks;
-   result = dll(-y) or result;
+   if (level.second()) {
+     ++n_backtracks;
+     result = dll(-y) or result;
+   }
 #else
    if (dll(y)) return true;
-   ++n_backtracks;
-   if (dll(-y)) return true;
+   if (level.second()) {
+     ++n_backtracks;
+     if (dll(-y)) return true;
+   }
 #endif
 #ifdef PURE_LITERALS
    changes.reactivate_1();
@@ -1666,10 +2810,12 @@ DLL_return_t dll0() { // without unit-clauses
 #ifdef PURE_LITERALS
   if (not r_clauses) {sat_pass = pass; return true;}
 #endif
+  Decision_level level(x);
   const DLL_return_t res1 = dll(x);
 #ifndef ALL_SOLUTIONS
   if (res1) return true;
 #endif
+  if (not level.second()) return res1;
   ++n_backtracks;
   const DLL_return_t res2 = dll(-x);
   return res1 or res2;
@@ -1679,6 +2825,407 @@ DLL_return_t dll0() { // without unit-clauses
 }
 
 
+// --- Cube-and-conquer ---
+
+/* Splitting (options "-split=depth:D" resp. "-split=nodes:N"): the search
+   is stopped at the nodes with D decisions resp. at all nodes after the
+   first N nodes, and for each such node the cube (the sequence of decisions
+   leading to it) is output (to the solutions-output) as "a x1 ... xk 0"
+   (iCNF); for ALL_SOLUTIONS also the satisfied leaves are output as cubes,
+   while otherwise the first satisfying assignment found ends the run.
+   Conquering (option "-conquer=cubefile"): each cube from cubefile is
+   solved, and the results are aggregated, where with PARALLEL the workers
+   first take the cubes, and then steal work as for the normal search.
+*/
+enum class Split_mode { none, depth, nodes };
+Split_mode split_mode = Split_mode::none;
+Count_statistics split_bound;
+Count_statistics n_cubes; // number of cubes output by splitting
+Lit_vec cube; // the decisions leading to the current node (splitting)
+std::string cube_filename; // conquering iff not empty
+std::vector<Lit_vec> cubes; // the cubes to be conquered
+
+inline bool cut() noexcept {
+  return split_mode == Split_mode::depth ?
+    cube.size() >= split_bound : n_nodes > split_bound;
+}
+void output_cube() {
+  ++n_cubes;
+  solout << "a ";
+  for (const Lit x : cube) solout << x << " ";
+  solout << "0\n";
+}
+
+// The splitting-version of dll(x) (sequential):
+DLL_return_t split_dll(const Lit x) {
+  if (abort_request) abort_run(); // splitting is done by the main thread
+  ++n_nodes;
+  assert(x);
+  DLL_return_t result = false;
+
+  changes.start_new();
+  const Unit_stack unit_stack;
+  Unit_stack::push(x);
+  assign_0(Unit_stack::pop());
+  while (unit_stack) {
+    if (push_unit_clause.contradiction()) goto only_neg_units;
+    ++n_units;
+    assign_0(Unit_stack::pop());
+  }
+
+  changes.start_new();
+  for (const Lit y : unit_stack) assign_1(y);
+  cube.push_back(x);
+  if (not r_clauses) {
+#ifdef ALL_SOLUTIONS
+    output_cube();
+#else
+    sat_pass = pass;
+    return true;
+#endif
+  }
+  else if (cut()) output_cube();
+  else {
+    const Lit y = branching_literal();
+#ifdef PURE_LITERALS
+    const PureLiterals pure_stack;
+    if (not r_clauses) {sat_pass = pass; return true;}
+#endif
+    result = split_dll(y);
+#ifndef ALL_SOLUTIONS
+    if (result) return true;
+#endif
+    ++n_backtracks;
+    result = split_dll(-y) or result;
+#ifdef PURE_LITERALS
+    changes.reactivate_1();
+#endif
+  }
+  cube.pop_back();
+  changes.reactivate_1();
+only_neg_units :
+  changes.reactivate_0();
+  return result;
+}
+
+DLL_return_t split0() {
+  ++n_nodes;
+  if (not n_clauses) {
+#ifdef ALL_SOLUTIONS
+    output_cube();
+    return false;
+#else
+    return true;
+#endif
+  }
+  const Lit x = branching_literal();
+#ifdef PURE_LITERALS
+  if (not r_clauses) {sat_pass = pass; return true;}
+#endif
+  const DLL_return_t res1 = split_dll(x);
+#ifndef ALL_SOLUTIONS
+  if (res1) return true;
+#endif
+  ++n_backtracks;
+  const DLL_return_t res2 = split_dll(-x);
+  return res1 or res2;
+}
+
+// Reading the cubes (the lines starting with "a ") from cube_filename:
+void read_cubes() {
+  std::ifstream f(cube_filename);
+  if (not f) {
+    errout << ("Invalid cube-file: \"" + cube_filename + "\".");
+    std::exit(file_reading_error);
+  }
+  std::string line;
+  while (std::getline(f, line)) {
+    if (line.size() < 2 or line[0] != 'a' or line[1] != ' ') continue;
+    std::istringstream s(line.substr(2));
+    Lit_vec c;
+    Lit x;
+    while (s >> x and x) {
+      if (var(x) > max_occ_var) {
+        errout << ("Variable " + std::to_string(var(x)) + " in cube "
+                   + std::to_string(cubes.size()+1) + " does not occur in"
+                   " the formula.");
+        std::exit(cube_error);
+      }
+      c.push_back(x);
+    }
+    if (not s) {
+      errout << ("Invalid cube " + std::to_string(cubes.size()+1) + ".");
+      std::exit(cube_error);
+    }
+    cubes.push_back(std::move(c));
+  }
+}
+
+// Solving the current node (without unit-clauses), the end of a cube:
+DLL_return_t conquer_node() {
+  ++n_nodes;
+  if (not r_clauses) {
+#ifdef ALL_SOLUTIONS
+    add_solutions();
+#else
+# ifdef PARALLEL
+    if (pool.halt())
+# endif
+    sat_pass = pass;
+#endif
+    return true;
+  }
+  const Lit y = branching_literal();
+#ifdef PURE_LITERALS
+  const PureLiterals pure_stack;
+  if (not r_clauses) {sat_pass = pass; return true;}
+#endif
+  Decision_level level(y);
+  DLL_return_t result = dll(y);
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#endif
+  if (level.second()) {
+    ++n_backtracks;
+    result = dll(-y) or result;
+  }
+#ifdef PURE_LITERALS
+  changes.reactivate_1();
+#endif
+  return result;
+}
+
+/* Conquering the cube [p, end): its literals are assigned in order (each
+   followed by unit-clause propagation; literals already true are skipped,
+   literals already false refute the cube), and then the remaining formula
+   is solved: */
+DLL_return_t conquer(const Lit* const p, const Lit* const end) {
+  if (p == end) return conquer_node();
+  const Lit x = *p;
+  if (pass[var(x)] == x) return conquer(p+1, end);
+  if (pass[var(x)] == -x) return false;
+  DLL_return_t result = false;
+
+  changes.start_new();
+  const Unit_stack unit_stack;
+  Unit_stack::push(x);
+  assign_0(Unit_stack::pop());
+  while (unit_stack) {
+    if (push_unit_clause.contradiction()) goto only_neg_units;
+    ++n_units;
+    assign_0(Unit_stack::pop());
+  }
+
+  changes.start_new();
+  for (const Lit y : unit_stack) assign_1(y);
+  Path::push(x, false);
+  result = conquer(p+1, end);
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#endif
+  Path::pop();
+  changes.reactivate_1();
+only_neg_units :
+  changes.reactivate_0();
+  return result;
+}
+
+#ifdef PARALLEL
+std::atomic<std::size_t> next_cube{0};
+#endif
+// Conquering the cubes (with PARALLEL: those not taken by other workers):
+DLL_return_t conquer_cubes() {
+  // Without clauses only the empty cube is possible (conquered once):
+  if (not n_clauses) return cubes.empty() ? false : dll0();
+  DLL_return_t result = false;
+#ifndef PARALLEL
+  for (const Lit_vec& c : cubes) {
+#else
+  for (std::size_t i; (i = next_cube.fetch_add(1, std::memory_order_relaxed))
+         < cubes.size() and not pool.stopped();) {
+    const Lit_vec& c = cubes[i];
+#endif
+    result = conquer(c.data(), c.data() + c.size()) or result;
+#ifndef ALL_SOLUTIONS
+    if (result) break;
+#endif
+  }
+  return result;
+}
+
+
+// --- Parallel search ---
+
+#ifdef PARALLEL
+/* Replaying the decisions [p, end) of a job (as done by the donating
+   thread), and then running dll on the last decision: */
+DLL_return_t replay(const Lit* const p, const Lit* const end) {
+  assert(p != end);
+  const Lit x = *p;
+  if (p+1 == end) {
+    Path::push(x, false);
+    const DLL_return_t result = dll(x);
+    Path::pop();
+    return result;
+  }
+  ++n_replayed;
+  changes.start_new();
+  const Unit_stack unit_stack;
+  Unit_stack::push(x);
+  assign_0(Unit_stack::pop());
+  while (unit_stack) {
+    [[maybe_unused]] const bool contradiction =
+      push_unit_clause.contradiction();
+    assert(not contradiction);
+    assign_0(Unit_stack::pop());
+  }
+  changes.start_new();
+  for (const Lit y : unit_stack) assign_1(y);
+  assert(r_clauses);
+  Path::push(x, false);
+  const DLL_return_t result = replay(p+1, end);
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#endif
+  Path::pop();
+  changes.reactivate_1();
+  changes.reactivate_0();
+  return result;
+}
+
+// Processing jobs from the pool until termination:
+DLL_return_t process_jobs() {
+  DLL_return_t result = false;
+  Lit_vec job;
+  while (pool.get(job)) {
+    ++n_backtracks; // the root of the job is a second branch
+    result = replay(&job[0], &job[0] + job.size()) or result;
+  }
+  return result;
+}
+
+// The thread-local statistics, to be added up over the threads:
+struct Statistics {
+  Count_statistics nodes, backtracks, units, evaluations, donations, replayed;
+  Count_statistics proj, proj2zero, proj1zero,
+    nofirst, withfirst, nosecond, withsecond;
+  Weight_t sum1, sum2, sumsq1, sumsq2, min1, min2, max1, max2;
+# ifdef TAU_ITERATION
+  Count_statistics wtau_calls, tau_iterations;
+# endif
+# ifdef ALL_SOLUTIONS
+  Count_solutions solutions;
+# endif
+# ifdef VAR_MARGINALS
+  SolCount_vec marginals;
+# endif
+# ifdef PHASE_STATISTICS
+  Phase_counts pcalls, pcycles;
+# endif
+
+  static Statistics current() {
+    Statistics s{n_nodes, n_backtracks, n_units, n_evaluations, n_donations,
+      n_replayed, n_proj, n_proj2zero, n_proj1zero,
+      n_nofirst, n_withfirst, n_nosecond, n_withsecond,
+      sum_first, sum_second, sumsq_first, sumsq_second,
+      min_first, min_second, max_first, max_second};
+# ifdef TAU_ITERATION
+    s.wtau_calls = wtau_calls; s.tau_iterations = tau_iterations;
+# endif
+# ifdef ALL_SOLUTIONS
+    s.solutions = n_solutions;
+# endif
+# ifdef VAR_MARGINALS
+    s.marginals.resize(marginals.size());
+    for (Var i = 1; i < marginals.size(); ++i) s.marginals[i] = marginals[i];
+# endif
+# ifdef PHASE_STATISTICS
+    s.pcalls = phase_calls; s.pcycles = phase_cycles;
+# endif
+    return s;
+  }
+  // Adding s to the statistics of the current thread:
+  static void add(const Statistics& s) noexcept {
+    n_nodes += s.nodes; n_backtracks += s.backtracks; n_units += s.units;
+    n_evaluations += s.evaluations;
+    n_donations += s.donations; n_replayed += s.replayed;
+    n_proj += s.proj; n_proj2zero += s.proj2zero; n_proj1zero += s.proj1zero;
+    n_nofirst += s.nofirst; n_withfirst += s.withfirst;
+    n_nosecond += s.nosecond; n_withsecond += s.withsecond;
+    sum_first += s.sum1; sum_second += s.sum2;
+    sumsq_first += s.sumsq1; sumsq_second += s.sumsq2;
+    min_first = std::min(min_first, s.min1);
+    min_second = std::min(min_second, s.min2);
+    max_first = std::max(max_first, s.max1);
+    max_second = std::max(max_second, s.max2);
+# ifdef TAU_ITERATION
+    wtau_calls += s.wtau_calls; tau_iterations += s.tau_iterations;
+# endif
+# ifdef ALL_SOLUTIONS
+    n_solutions += s.solutions;
+# endif
+# ifdef VAR_MARGINALS
+    for (Var i = 1; i < marginals.size(); ++i) marginals[i] += s.marginals[i];
+# endif
+# ifdef PHASE_STATISTICS
+    for (unsigned i = 0; i < n_phases; ++i) {
+      phase_calls[i] += s.pcalls[i]; phase_cycles[i] += s.pcycles[i];
+    }
+# endif
+  }
+};
+
+DLL_return_t no_work() { return false; }
+
+/* Running n_threads workers, where the calling thread is the first worker
+   starting with first(), while the others (after copying its formula)
+   start with others(), and then all process the jobs; signals are only
+   handled by the calling thread:
+*/
+DLL_return_t parallel_run(DLL_return_t (*const first)(),
+                          DLL_return_t (*const others)()) {
+  assert(n_threads >= 2);
+  pool.init(n_threads);
+  std::vector<Statistics> stats(n_threads);
+  std::vector<char> results(n_threads, false);
+  std::latch ready(n_threads - 1);
+  const Clauses& F = clauses;
+  const LiteralOccurrences& L = lits;
+
+  sigset_t sigs, old_sigs;
+  sigemptyset(&sigs);
+  sigaddset(&sigs, SIGINT); sigaddset(&sigs, SIGUSR1);
+  pthread_sigmask(SIG_BLOCK, &sigs, &old_sigs);
+  std::vector<std::thread> workers;
+  workers.reserve(n_threads - 1);
+  for (unsigned i = 1; i < n_threads; ++i)
+    workers.emplace_back([&, i]{
+      try { thread_initialisation(); copy_formula(F, L); }
+      catch (const std::bad_alloc&) {
+        errout << ("Allocation error with initialisation of worker " +
+                   std::to_string(i) + ".");
+        std::exit(allocation_error);
+      }
+      ready.count_down();
+      results[i] = others();
+      results[i] = process_jobs() or results[i];
+      stats[i] = Statistics::current();
+    });
+  pthread_sigmask(SIG_SETMASK, &old_sigs, nullptr);
+  ready.wait();
+
+  DLL_return_t result = first();
+  result = process_jobs() or result;
+  for (auto& w : workers) w.join();
+  for (unsigned i = 1; i < n_threads; ++i) {
+    result = results[i] or result;
+    Statistics::add(stats[i]);
+  }
+  return result;
+}
+#endif
+
+
 // --- Output ---
 
 void show_usage() {
@@ -1702,10 +3249,21 @@ void show_usage() {
     "> " << program << " In Out Out\n"
     "the input comes from file In, and both statistics and assignments are appended to Out "
 #ifndef ALL_SOLUTIONS
-      "(first the statistics).\n";
+      "(first the statistics).\n"
 #else
-      "(first the solutions).\n";
+      "(first the solutions).\n"
 #endif
+    "The option \"-rthreads=N\" (anywhere) sets the maximal number of threads for reading the input-file (default is " << n_read_threads << ").\n"
+#ifdef PARALLEL
+    "The option \"-threads=N\" (anywhere) sets the number of worker-threads (default is " << n_threads << ").\n"
+#endif
+    "The option \"-split=depth:D\" resp. \"-split=nodes:N\" (anywhere) only splits the formula, outputting the cubes (\"a ... 0\") for the nodes with D decisions resp. after the first N nodes to the solutions-output.\n"
+    "The option \"-conquer=cubefile\" (anywhere) solves the formula for all cubes in cubefile, aggregating the results.\n"
+#ifndef PARALLEL
+    "The option \"-checkpoint=file\" (anywhere) writes checkpoints to file on SIGUSR2, SIGINT (then aborting) and every S seconds (\"-cpinterval=S\", default " << checkpoint_interval << ").\n"
+    "The option \"-resume=file\" (anywhere) resumes the search from the checkpoint in file.\n"
+#endif
+    ;
   std::exit(0);
 }
 
@@ -1713,6 +3271,18 @@ void show_usage() {
 #define STR(x) S(x)
 
 const std::string options = ""
+#ifdef PARALLEL
+"p"
+#endif
+#ifdef FLAT_CLAUSES
+"a"
+#endif
+#ifdef INCREMENTAL_SCORES
+"i"
+#endif
+#ifdef PHASE_STATISTICS
+"S"
+#endif
 #if UCP_STRATEGY == 0
 "B"
 #endif
@@ -1731,7 +3301,8 @@ const std::string options = ""
 # else
 "A"
 # endif
-    + std::string(floating_count ? "F" : "") + std::to_string(count_digits)
+    + (gmp_count ? std::string("G") :
+       std::string(floating_count ? "F" : "") + std::to_string(count_digits))
 #endif
 #ifdef LAMBDA
     + std::string("L" STR(LAMBDA))
@@ -1766,11 +3337,16 @@ void version_information() {
 #endif
 #ifdef ALL_SOLUTIONS
    " Compiled with ALL_SOLUTIONS\n"
-   "  COUNT_T = " STR(COUNT_T) " (with " << count_bits << " binary digits)\n"
-   "   ";
-   if (floating_count) std::cout << "a floating-point type";
-   else std::cout << "an unsigned integral type";
-   std::cout << " with " << count_digits << " decimal digits\n"
+   "  COUNT_T = " STR(COUNT_T);
+   if (gmp_count) std::cout << " (GMP)\n"
+     "   an arbitrary-precision integral type\n";
+   else {
+     std::cout << " (with " << count_bits << " binary digits)\n   ";
+     if (floating_count) std::cout << "a floating-point type";
+     else std::cout << "an unsigned integral type";
+     std::cout << " with " << count_digits << " decimal digits\n";
+   }
+   std::cout <<
 #else
    " Compiled without ALL_SOLUTIONS\n"
 #endif
@@ -1788,6 +3364,15 @@ void version_information() {
 #ifdef ALPHA
    " Compiled with ALPHA=" STR(ALPHA) "\n"
 #endif
+#ifdef PARALLEL
+   " Compiled with PARALLEL\n"
+#endif
+#ifdef FLAT_CLAUSES
+   " Compiled with FLAT_CLAUSES\n"
+#endif
+#ifdef INCREMENTAL_SCORES
+   " Compiled with INCREMENTAL_SCORES\n"
+#endif
 #ifdef NDEBUG
    " Compiled with NDEBUG defined\n"
 #else
@@ -1849,7 +3434,6 @@ Time_points_2 t0; // start of whole computation
 Time_points_2 t1; // start of SAT solving
 
 // Wall-clock:
-typedef std::chrono::time_point<std::chrono::high_resolution_clock> WTime_point;
 WTime_point t0W, t1W;
 
 
@@ -1917,6 +3501,11 @@ if (logout.active()) {
          "c   1-reductions_per_node               " << double(n_units) / n_nodes << "\n"
 #ifdef PURE_LITERALS
          "c   number_of_pure_literals             " << n_pure_literals << "\n"
+#endif
+#ifdef PARALLEL
+         "c threads                               " << n_threads << "\n"
+         "c   donated_jobs                        " << n_donations << "\n"
+         "c   replayed_decisions                  " << n_replayed << "\n"
 #endif
          << std::setprecision(prec_heuristics) << fi <<
          "c heuristics_evaluations                " << n_evaluations << "\n"
@@ -1964,8 +3553,42 @@ if (logout.active()) {
 #endif
          "c reading-and-set-up_time(sec)          " << std::setprecision(prec_time_small) << std::fixed << (t1 - t0)[0] << "\n"
          "c   system                              " << (t1 - t0)[1] << "\n"
-         "c   elapsed                             " << diff_t(t1W-t0W).count()
+         "c   elapsed                             " << diff_t(t1W-t0W).count() << "\n"
+         "c   reading_threads                     " << n_reading_threads << "\n"
+         "c   parsing_time                        " << parsing_time.count() << "\n"
+         "c   clauses_time                        " << clauses_time.count() << "\n"
+         "c   occurrences_time                    " << occurrences_time.count() << "\n"
+         "c   initialisation_time                 " << initialisation_time.count()
   ;
+  if (split_mode != Split_mode::none)
+    logout << "\n"
+         "c splitting                             " <<
+           (split_mode == Split_mode::depth ? "depth:" : "nodes:") << split_bound << "\n"
+         "c   number_of_cubes                     " << n_cubes;
+  else if (not cube_filename.empty())
+    logout << "\n"
+         "c cube_file                             " << cube_filename << "\n"
+         "c   number_of_cubes                     " << cubes.size();
+  if (not resume_file.empty())
+    logout << "\n"
+         "c resumed_from                          " << resume_file;
+  if (not checkpoint_file.empty())
+    logout << "\n"
+         "c checkpoint_file                       " << checkpoint_file << "\n"
+         "c   number_of_checkpoints               " << n_checkpoints;
+#ifdef PHASE_STATISTICS
+  logout << "\n"
+         "c phase_statistics                      " << cycles_source;
+  for (unsigned i = 0; i < n_phases; ++i) {
+    const auto key = [i](const std::string& what) {
+      std::string k = "c   " + phase_names[i] + what;
+      k.resize(std::max<std::size_t>(40, k.size()+1), ' ');
+      return k;
+    };
+    logout << "\n" << key("_calls") << phase_calls[i]
+           << "\n" << key("_cycles") << phase_cycles[i];
+  }
+#endif
   logout.endl();
 }
 #ifndef ALL_SOLUTIONS
@@ -1997,6 +3620,10 @@ void set_output(const int argc, const char* const argv[]) {
       errout << ("Invalid output filename: \"" + solname + "\".");
       std::exit(file_writing_error);
     }
+#ifdef GZIP_SOLUTIONS
+    if (solname.ends_with(".gz")) solout.p = new Gzostream(solname);
+    else
+#endif
     solout.p = new std::ofstream(solname, std::ios::app);
     if (not *solout.p) {
       errout << ("Invalid output file: \"" + solname + "\".");
@@ -2025,8 +3652,84 @@ void set_output(const int argc, const char* const argv[]) {
   }
 }
 
+/* Removing the options "-key=value" from the command-line (they can occur
+   anywhere), returning the remaining arguments (with the program name): */
+std::vector<const char*> extract_options(const int argc, const char* const argv[]) {
+  std::vector<const char*> args;
+  for (int i = 0; i < argc; ++i) {
+    const std::string a(argv[i]);
+    const auto eq = a.find('=');
+    if (i == 0 or a.size() < 2 or a[0] != '-' or eq == std::string::npos) {
+      args.push_back(argv[i]); continue;
+    }
+    const std::string key = a.substr(1, eq-1), value = a.substr(eq+1);
+    const auto positive = [&a](const std::string& value) {
+      const auto invalid = [&a]{
+        errout << ("Invalid option \"" + a + "\" (must be a positive integer).");
+        std::exit(option_error);
+      };
+      if (value.empty() or value.find_first_not_of("0123456789") != std::string::npos)
+        invalid();
+      unsigned long n = 0;
+      try { n = std::stoul(value); }
+      catch (const std::exception&) { invalid(); }
+      if (n == 0 or n > std::numeric_limits<unsigned>::max()) invalid();
+      return unsigned(n);
+    };
+    if (key == "rthreads") n_read_threads = positive(value);
+    else if (key == "threads") {
+#ifdef PARALLEL
+      n_threads = positive(value);
+#else
+      errout << ("Option \"" + a + "\" needs compilation with PARALLEL.");
+      std::exit(option_error);
+#endif
+    }
+    else if (key == "split") {
+      const auto colon = value.find(':');
+      const std::string mode = value.substr(0, colon);
+      if (colon == std::string::npos or (mode != "depth" and mode != "nodes")) {
+        errout << ("Invalid option \"" + a + "\" (must be -split=depth:D or"
+                   " -split=nodes:N).");
+        std::exit(option_error);
+      }
+      split_mode = mode == "depth" ? Split_mode::depth : Split_mode::nodes;
+      split_bound = positive(value.substr(colon+1));
+    }
+    else if (key == "conquer" and not value.empty()) cube_filename = value;
+    else if (key == "checkpoint" and not value.empty()) checkpoint_file = value;
+    else if (key == "cpinterval") checkpoint_interval = positive(value);
+    else if (key == "resume" and not value.empty()) resume_file = value;
+    else {
+      errout << ("Unknown option \"" + a + "\".");
+      std::exit(option_error);
+    }
+  }
+  if (split_mode != Split_mode::none and not cube_filename.empty()) {
+    errout << "Options -split and -conquer exclude each other.";
+    std::exit(option_error);
+  }
+  if (not checkpoint_file.empty() or not resume_file.empty()) {
+#ifdef PARALLEL
+    errout << "Options -checkpoint and -resume need compilation without PARALLEL.";
+    std::exit(option_error);
+#endif
+    if (split_mode != Split_mode::none or not cube_filename.empty()) {
+      errout << "Options -checkpoint and -resume exclude -split and -conquer.";
+      std::exit(option_error);
+    }
+  }
+  return args;
+}
+
 void abortion(const int) {
   std::signal(SIGINT, abortion);
+  abort_request = true;
+}
+void abort_run() {
+#ifdef ALL_SOLUTIONS
+  solwriter.finish();
+#endif
   output(unknown);
   std::exit(unknown);
 }
@@ -2035,9 +3738,247 @@ void show_statistics(const int) {
   output(unknown);
 }
 
+
+// --- Checkpoints ---
+
+#ifndef PARALLEL
+/* A checkpoint is written at the beginning of a node of dll (before its
+   node is counted), and consists of the statistics so far and of the
+   decision path to that node, which is all what is needed to resume: the
+   search continues with that node, followed by the pending second
+   branches of the path.
+*/
+volatile std::sig_atomic_t searching = false;
+std::uint64_t formula_hash;
+
+// FNV-1a over the literals of the clauses:
+std::uint64_t compute_formula_hash() {
+  std::uint64_t h = 14695981039346656037ULL;
+  const auto add = [&h](const std::uint64_t x) {
+    h ^= x; h *= 1099511628211ULL;
+  };
+  for_each_clause(clauses.cl, [&add](const Clause& C, Clause_ref) {
+    for (const Lit x : C) add(std::uint64_t(var(x)) << 1 | (sign(x) == neg));
+    add(0);
+  });
+  return h;
+}
+
+// The counters and weight-statistics saved in a checkpoint:
+std::vector<std::pair<std::string, Count_statistics*>> checkpoint_counters() {
+  return {{"nodes", &n_nodes}, {"backtracks", &n_backtracks},
+    {"units", &n_units}, {"evaluations", &n_evaluations},
+#ifndef FIRST_VARIABLE
+    {"proj", &n_proj}, {"proj2zero", &n_proj2zero},
+    {"proj1zero", &n_proj1zero}, {"nofirst", &n_nofirst},
+    {"withfirst", &n_withfirst}, {"nosecond", &n_nosecond},
+    {"withsecond", &n_withsecond},
+#endif
+#ifdef PURE_LITERALS
+    {"pure_literals", &n_pure_literals},
+#endif
+#ifdef TAU_ITERATION
+    {"wtau_calls", &wtau_calls}, {"tau_iterations", &tau_iterations},
+#endif
+  };
+}
+#ifndef FIRST_VARIABLE
+std::vector<std::pair<std::string, Weight_t*>> checkpoint_weights() {
+  return {{"sum_first", &sum_first}, {"sum_second", &sum_second},
+    {"sumsq_first", &sumsq_first}, {"sumsq_second", &sumsq_second},
+    {"min_first", &min_first}, {"min_second", &min_second},
+    {"max_first", &max_first}, {"max_second", &max_second}};
+}
+#endif
+
+// Writing to checkpoint_file.tmp, and then renaming it to checkpoint_file:
+void write_checkpoint() {
+  const bool abort = checkpoint_request == checkpoint_abort;
+  checkpoint_request = no_request;
+#ifdef ALL_SOLUTIONS
+  solwriter.sync(); // the solutions found so far are in the output
+#endif
+  const std::string tmp = checkpoint_file + ".tmp";
+  {std::ofstream out(tmp);
+   out << "c tawSolver-checkpoint\n"
+     "program " << program << "\n"
+     "version " << version << "\n"
+     "options " << options << "\n"
+     "formula " << n_vars << " " << max_occ_var << " " << n_clauses << " "
+       << n_lit_occurrences << " " << formula_hash << "\n";
+   for (const auto& [key, p] : checkpoint_counters())
+     out << key << " " << *p << "\n";
+#ifndef FIRST_VARIABLE
+   out << std::setprecision(std::numeric_limits<Weight_t>::max_digits10);
+   for (const auto& [key, p] : checkpoint_weights())
+     out << key << " " << *p << "\n";
+#endif
+#ifdef ALL_SOLUTIONS
+   out << std::setprecision(std::numeric_limits<Count_solutions>::max_digits10)
+     << "solutions " << n_solutions << "\n"
+     "found_solutions " << found_solutions << "\n";
+#endif
+#ifdef VAR_MARGINALS
+   out << "marginals";
+   for (Var i = 1; i <= n_vars; ++i) out << " " << marginals[i];
+   out << "\n";
+#endif
+   out << "path";
+   for (const Path::Decision* d = Path::begin(); d != Path::end(); ++d)
+     out << " " << d->x << " " << d->pending;
+   out << "\n";
+   out.close();
+   if (not out or std::rename(tmp.c_str(), checkpoint_file.c_str()) != 0)
+     errout << ("Checkpoint could not be written to \"" + checkpoint_file +
+                "\" (continuing).");
+   else ++n_checkpoints;
+  }
+  if (abort) abort_run();
+}
+
+void request_checkpoint(const int) {
+  std::signal(SIGUSR2, request_checkpoint);
+  if (not checkpoint_request) checkpoint_request = checkpoint;
+}
+void timed_checkpoint(const int) {
+  std::signal(SIGALRM, timed_checkpoint);
+  if (not checkpoint_request) checkpoint_request = checkpoint;
+  alarm(checkpoint_interval);
+}
+// On SIGINT during the search, first a checkpoint is written (a second
+// SIGINT aborts at once):
+void checkpoint_abortion(const int) {
+  std::signal(SIGINT, checkpoint_abortion);
+  if (not searching or checkpoint_request == checkpoint_abort) abortion(0);
+  checkpoint_request = checkpoint_abort;
+}
+
+// The decisions of the checkpoint to resume from:
+std::vector<Path::Decision> resume_path;
+
+void read_checkpoint() {
+  const auto invalid = [](const std::string& what) {
+    errout << ("Invalid checkpoint-file \"" + resume_file + "\": " + what + ".");
+    std::exit(checkpoint_error);
+  };
+  if (not n_clauses) invalid("formula without clauses");
+  std::ifstream in(resume_file);
+  if (not in) {
+    errout << ("Checkpoint-file \"" + resume_file + "\" can not be opened.");
+    std::exit(file_reading_error);
+  }
+  std::string line;
+  if (not std::getline(in, line) or line != "c tawSolver-checkpoint")
+    invalid("wrong first line");
+  std::map<std::string, std::string> entries;
+  while (std::getline(in, line)) {
+    const auto space = line.find(' ');
+    entries[line.substr(0, space)] =
+      space == std::string::npos ? "" : line.substr(space+1);
+  }
+  const auto entry = [&entries, &invalid](const std::string& key) {
+    const auto it = entries.find(key);
+    if (it == entries.end()) invalid("missing \"" + key + "\"");
+    return it->second;
+  };
+  if (entry("options") != options)
+    invalid("options \"" + entry("options") + "\" instead of \"" + options + "\"");
+  {std::ostringstream f;
+   f << n_vars << " " << max_occ_var << " " << n_clauses << " "
+     << n_lit_occurrences << " " << formula_hash;
+   if (entry("formula") != f.str()) invalid("different formula");
+  }
+  try {
+    for (const auto& [key, p] : checkpoint_counters()) *p = std::stoull(entry(key));
+#ifndef FIRST_VARIABLE
+    for (const auto& [key, p] : checkpoint_weights()) *p = std::stold(entry(key));
+#endif
+#ifdef ALL_SOLUTIONS
+    n_solutions = read_count(entry("solutions"));
+    found_solutions = std::stoul(entry("found_solutions"));
+#endif
+#ifdef VAR_MARGINALS
+    std::istringstream m(entry("marginals"));
+    std::string c;
+    for (Var i = 1; i <= n_vars; ++i) {
+      if (not (m >> c)) invalid("wrong marginals");
+      marginals[i] = read_count(c);
+    }
+#endif
+  }
+  catch (const std::exception&) { invalid("wrong number"); }
+  std::istringstream p(entry("path"));
+  Lit x; int pending;
+  while (p >> x >> pending) {
+    if (not x or var(x) > max_occ_var or (pending != 0 and pending != 1))
+      invalid("wrong path");
+    resume_path.push_back({x, bool(pending)});
+  }
+  if (not p.eof() or resume_path.empty()) invalid("wrong path");
+}
+
+/* Resuming the search at the decisions [p, end) (at the current node),
+   where the last decision is the node where the checkpoint was taken: */
+DLL_return_t resume(const Path::Decision* const p, const Path::Decision* const end) {
+  assert(p != end);
+  const Lit x = p->x;
+  if (pass[var(x)]) {
+    errout << ("Invalid path in checkpoint-file \"" + resume_file + "\".");
+    std::exit(checkpoint_error);
+  }
+  Path::Decision* const d = Path::push(x, p->pending);
+  DLL_return_t result = false;
+  if (p+1 == end) result = dll(x);
+  else {
+    changes.start_new();
+    const Unit_stack unit_stack;
+    Unit_stack::push(x);
+    assign_0(Unit_stack::pop());
+    while (unit_stack) {
+      if (push_unit_clause.contradiction()) {
+        errout << ("Invalid path in checkpoint-file \"" + resume_file + "\".");
+        std::exit(checkpoint_error);
+      }
+      assign_0(Unit_stack::pop());
+    }
+    changes.start_new();
+    for (const Lit y : unit_stack) assign_1(y);
+    result = resume(p+1, end);
+#ifndef ALL_SOLUTIONS
+    if (result) return true;
+#endif
+    changes.reactivate_1();
+    changes.reactivate_0();
+  }
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#endif
+  if (d->pending) {
+    d->x = -x; d->pending = false;
+    ++n_backtracks;
+    result = dll(-x) or result;
+  }
+  Path::pop();
+  return result;
+}
+DLL_return_t resume0() {
+  const DLL_return_t result =
+    resume(&resume_path[0], &resume_path[0] + resume_path.size());
+#ifdef ALL_SOLUTIONS
+  return result or found_solutions;
+#else
+  return result;
+#endif
+}
+#endif
+
 } // anonymous namespace
 
-int main(const int argc, const char* const argv[]) {
+#ifndef SOLVER_CORE
+int main(const int argc0, const char* const argv0[]) {
+  const auto args = extract_options(argc0, argv0);
+  const int argc = args.size();
+  const char* const* const argv = args.data();
   if (argc == 1) show_usage();
   filename = argv[1];
   if (filename == "-v" or filename == "--version") version_information();
@@ -2047,20 +3988,60 @@ int main(const int argc, const char* const argv[]) {
   t0W = std::chrono::high_resolution_clock::now();
   t0 = timing();
   read_formula(filename);
+  if (not cube_filename.empty()) read_cubes();
   if (n_clauses) {
+    const WTime_point ti = std::chrono::high_resolution_clock::now();
     try { initialisation(); }
     catch (const std::bad_alloc&) {
       errout << "Allocation error with initialisation of algorithmic"
        " data structures.";
       return allocation_error;
     }
+    initialisation_time = std::chrono::high_resolution_clock::now() - ti;
   }
+#ifndef PARALLEL
+  if (not checkpoint_file.empty() or not resume_file.empty())
+    formula_hash = compute_formula_hash();
+  if (not resume_file.empty()) read_checkpoint();
+  if (not checkpoint_file.empty()) {
+    std::signal(SIGINT, checkpoint_abortion);
+    std::signal(SIGUSR2, request_checkpoint);
+    std::signal(SIGALRM, timed_checkpoint);
+    alarm(checkpoint_interval);
+  }
+  else
+#endif
   std::signal(SIGINT, abortion);
   std::signal(SIGUSR1, show_statistics);
+#ifdef ALL_SOLUTIONS
+  if (split_mode == Split_mode::none and not solout.shares(logout))
+    solwriter.start(solout);
+#endif
   t1 = timing();
   t1W = std::chrono::high_resolution_clock::now();
-  const auto result = dll0();
-  const auto ires = interprete_run(result);
+  Result_value ires;
+  if (split_mode != Split_mode::none) {
+    const DLL_return_t result = split0();
+    ires = result ? sat : n_cubes == 0 ? unsat : unknown;
+  }
+  else {
+    const auto start = cube_filename.empty() ? dll0 : conquer_cubes;
+#ifndef PARALLEL
+    searching = true;
+    const auto result = resume_file.empty() ? start() : resume0();
+    searching = false;
+#else
+    const auto result = n_clauses and n_threads >= 2 ?
+      parallel_run(start, cube_filename.empty() ? no_work : conquer_cubes) :
+      start();
+#endif
+    ires = interprete_run(result);
+  }
+  if (abort_request) abort_run();
+#ifdef ALL_SOLUTIONS
+  solwriter.finish();
+#endif
   output(ires);
   return ires;
 }
+#endif
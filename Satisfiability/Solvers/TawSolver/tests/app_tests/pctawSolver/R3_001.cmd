@@ -0,0 +1 @@
+-cin -nil -cout -threads=3
\ No newline at end of file
@@ -9,6 +9,9 @@ License, or any later version. */
 
     - Algorithm shuffle for shuffling a sequence.
     - Algorithm choose_kn for choosing k random numbers from 0, ..., n-1.
+    - choose_kn_small(k, n, g, res, sorted) for k <= max_small_k, writing
+      into the caller-supplied array res (no allocation), with exactly
+      the same random choices and results as choose_kn.
 
 TODOS:
 
@@ -69,6 +72,9 @@ TODOS:
 #include <numeric>
 #include <algorithm>
 #include <map>
+#include <array>
+
+#include <cassert>
 
 // Guaranteed to be included:
 #include "Numbers.hpp"
@@ -155,6 +161,70 @@ namespace RandGen {
     }
   }
 
+
+  /* For small k, the map M of choose_kn_inclusion is replaced by an array
+     of at most k pairs with linear search, and the exclusion-case uses a
+     bitset; the result is written to res (at least k elements), and the
+     number of elements written is returned.
+  */
+  constexpr gen_uint_t max_small_k = 16;
+  typedef std::array<gen_uint_t, max_small_k> small_choice_t;
+
+  inline gen_uint_t choose_kn_inclusion_small(const gen_uint_t k, const gen_uint_t n, RandGen_t& g, gen_uint_t* const res) noexcept {
+    assert(k <= max_small_k);
+    if (k > n or k == 0) return 0;
+    using U = UniformRange<RandGen_t>;
+    res[0] = U(g, n)();
+    if (k == 1) return 1;
+    gen_uint_t key[max_small_k], val[max_small_k], m = 0;
+    const auto find = [&key, &m](const gen_uint_t x) noexcept {
+      gen_uint_t j = 0;
+      while (j < m and key[j] != x) ++j;
+      return j;
+    };
+    if (res[0] != n-1) { key[0] = res[0]; val[0] = n-1; m = 1; }
+    for (gen_uint_t i = 1; i < k; ++i) {
+      const gen_uint_t last = n-i-1;
+      const auto j_current = find(last);
+      const auto current = j_current == m ? last : val[j_current];
+      const auto choice = U(g, n-i)();
+      const auto j_choice = find(choice);
+      if (j_choice == m) {
+        res[i] = choice;
+        if (choice != last) { key[m] = choice; val[m] = current; ++m; }
+      }
+      else {
+        res[i] = val[j_choice];
+        if (choice != last) val[j_choice] = current;
+      }
+    }
+    return k;
+  }
+  inline gen_uint_t choose_kn_small(const gen_uint_t k, const gen_uint_t n, RandGen_t& g, gen_uint_t* const res, const bool sorted = false) noexcept {
+    assert(k <= max_small_k);
+    if (k > n or k == 0) return 0;
+    if (k > n/2) {
+      // Now n < 2k <= 32:
+      if (k == n) { std::iota(res, res+n, 0); return k; }
+      gen_uint_t excl[max_small_k];
+      const auto e = choose_kn_inclusion_small(n-k, n, g, excl);
+      std::uint32_t mask = 0;
+      for (gen_uint_t i = 0; i < e; ++i) mask |= std::uint32_t(1) << excl[i];
+      for (gen_uint_t i = 0, j = 0; i < n; ++i)
+        if (not (mask & (std::uint32_t(1) << i))) res[j++] = i;
+      return k;
+    }
+    choose_kn_inclusion_small(k, n, g, res);
+    if (sorted)
+      for (gen_uint_t i = 1; i < k; ++i) {
+        const gen_uint_t x = res[i];
+        gen_uint_t j = i;
+        for (; j != 0 and res[j-1] > x; --j) res[j] = res[j-1];
+        res[j] = x;
+      }
+    return k;
+  }
+
 }
 
 #endif
@@ -17,7 +17,7 @@ for information on the program, the version, and the environment.
 
 for basic help-information.
 
-> ./BRG [clauses] [options] [seeds] [output]
+> ./BRG [clauses] [options] [seeds] [output] [threads]
 
 for creation of random CNFS.
 
@@ -30,9 +30,9 @@ TODOS:
 -1 Update to the use of SeedOrganisation (as in LSRG.cpp), and write
    application-tests.
     - There are three generic parameters:
-     1 Currently last in ClauseSets we have the thread-index (a hypothetical
-       parameter for hypothetical parallel computation); perhaps this should
-       go first.
+     1 Currently last in ClauseSets we have the backend-flag (formerly the
+       thread-index, which is not needed, since the parallel computation
+       yields the same output); perhaps this should go first.
      2 The main structural parameters (renaming and ordering).
      3 The number of clause-blocks.
 
@@ -149,17 +149,19 @@ the context of the OKlibrary. Then the Git-id is just hardcoded.
 #include <fstream>
 #include <string>
 
+#include <Numerics/FloatingPoint.hpp>
 #include <ProgramOptions/Environment.hpp>
 
 #include "SeedOrganisation.hpp"
 #include "Numbers.hpp"
 #include "ClauseSets.hpp"
+#include "ParClauseSets.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.8",
-        "5.1.2021",
+        "0.6.1",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/BRG.cpp",
@@ -178,18 +180,19 @@ namespace {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
       return false;
     std::cout <<
-    "> " << proginfo.prg << " [clauses] [options] [seeds] [output]\n\n"
+    "> " << proginfo.prg << " [clauses] [options] [seeds] [output] [threads]\n\n"
     "   clauses : \"B1; ...; Bs\", with s >= 0 clause-blocks Bi\n"
     "     Bi    : \"C * P1 | ... | Pm\", with m >= 1 clause-parts Pi and C=#clauses\n"
     "     Pi    : \"N, W [, P]\", where\n"
     "              N=variable-range, W=#literals, P=#sign-probability\n"
     "   options : \"c1, ..., cl\", with l >= 0 option-choices ci from\n"
-    "               " << Environment::WRP<option_t>{} << ";\n"
-    "             defaults are the first values for both options\n"
+    "               " << Environment::WRP<extoption_t>{} << ";\n"
+    "             defaults are the first values for all options\n"
     "   seeds   : ";
     explanation_seeds(std::cout, 13);
     std::cout <<
-    "   output  : \"-cout\" (standard output) or \"\"[-]\"\" (default filename) or \"FILENAME\"\n\n"
+    "   output  : \"-cout\" (standard output) or \"\"[-]\"\" (default filename) or \"FILENAME\"\n"
+    "   threads : number >= 1 of threads (default 1), only for options \"u,o,xo\"\n\n"
     " computes the random CNF:\n\n"
     "  - The arguments are positional, not named (the names are used here only"
     " for communication).\n"
@@ -219,8 +222,10 @@ try {
     return int(Error::invalid_clauses);
   }
 
-  const GParam gpar = (argc <= index) ? GParam{} : GParam{Environment::translate<option_t>()(argv[index++], sep)};
-  const Param par{gpar, std::move(vpar)};
+  const extoption_t opt = (argc <= index) ? extoption_t{} : Environment::translate<extoption_t>()(argv[index++], sep);
+  const GParam gpar{std::get<SortO>(opt), std::get<RenameO>(opt)};
+  const RB rb = std::get<RB>(opt);
+  const Param par{gpar, std::move(vpar), rb};
 
   vec_eseed_t s = seeds(par);
   typedef vec_eseed_t::size_type evec_size_t;
@@ -251,6 +256,14 @@ try {
   }
   index++;
 
+  const unsigned threads = argc <= index ? 1 :
+    FloatingPoint::toUInt(argv[index++]);
+  if (threads == 0)
+    throw std::domain_error("threads = 0");
+  const bool parallel = gpar == GParam(-1) and rb == RB::xo;
+  if (threads >= 2 and not parallel)
+    throw std::domain_error("threads >= 2 only for options \"u,o,xo\"");
+
   index.deactivate();
 
   out << Environment::Wrap(proginfo, Environment::OP::dimacs);
@@ -262,16 +275,22 @@ try {
   Environment::args_output(out, argc, argv);
   out << "\n"
             << DWW{"output"} << qu(filename) << "\n"
-            << DWW{"options"} << gpar << "\n"
-            << DWW{"num_clause-blocks"} << par.vp.size() << "\n"
+            << DWW{"options"} << gpar << "\n";
+  if (rb != RB::mt) out << DWW{"backend"} << "\"" << rb << "\"\n";
+  out       << DWW{"num_clause-blocks"} << par.vp.size() << "\n"
             << DWW{" clause-blocks"} << par.vp << "\n"
             << DWW{"num_e-seeds"} << esize_system << "+" << esize_add << "=" << s.size() << "\n"
             << DWW{" e-seeds"} << ESW(s) << "\n";
   assert(not s.empty());
 
-  RandGen_t g(s);
+  RandGen_t g(s, backend(s));
 
-  if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp);
+  if (parallel) rand_clauselist(out, g, par.vp, threads);
+  else if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp);
+  else if (gpar.s() == SortO::hashed) {
+    const auto F = rand_hashedclauselist(g, par.vp, gpar.r()).first;
+    out << F.first << F.second;
+  }
   else out << random(g,par).first;
 
 }
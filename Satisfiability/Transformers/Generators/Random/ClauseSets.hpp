@@ -19,10 +19,12 @@ License, or any later version. */
   - typedef dimacs_pars for the two Dimacs-parameters
   - function extract_parameters(rparam_v) to compute the formal
     Dimacs-parameters
+  - function max_clause_length(rparam_v)
   - function read_rparam_v(string)
   - scoped enum SortO, RenameO for the two option-types
   - struct GParam, containing these two options
-  - struct Param for all parameters.
+  - extoption_t adds the random backend RB (for BRG, QBRG, DQBRG)
+  - struct Param for all parameters (including the backend).
 
  - Computing the seeds:
   - function add_seeds(RParam, vec_eseed_t&) for adding seeds according to
@@ -44,10 +46,18 @@ License, or any later version. */
  - The generation of random clauses:
 
   - rand_clause(g, C, n, k, p) for adding a random clause to a given clause C
+    (for k <= max_small_k via rand_clause_small, without allocations besides
+    for C; the clause-lists are computed with one clause-buffer)
+
+  - All following functions call g.unit(i) before creating the clause with
+    index i (counting over all blocks), so that for the backend RB::xo the
+    clause i is a pure function of the seeds and i (for rand_clauseset
+    including the rejected tries, which use the same unit).
 
   - rand_clauselist(out, g, par) for direct output to out, for option-value
     GParam(-1) (the completely unrestriced form)
   - rand_clauselist_core(out, g, par) does not output the Dimacs-line
+    (for the parallel versions see ParClauseSets.hpp)
 
   - rand_clauselist(g, par, RenameO) now computing a clause-list, and handling
     renaming
@@ -55,8 +65,13 @@ License, or any later version. */
     sorting the output, and removing duplicated clauses
   - rand_clauseset(g, par, RenameO) for the filtered version (rejecting
     duplicated clauses right away)
+  - class HashedClauseList, for the clauses without duplicates, in the
+    order of creation, packed into an arena, with an open-addressing
+    hash-table
+  - rand_hashedclauselist(g, par, RenameO) as rand_clauseset, but via
+    HashedClauseList (keeping the clauses in the order of creation)
 
-  - random(g, par) selects one of the previous three functions (for
+  - random(g, par) selects one of the previous four functions (for
     option-values != GParam(-1)),
 
 
@@ -75,11 +90,15 @@ License, or any later version. */
 #include <variant>
 #include <ostream>
 #include <string>
+#include <limits>
 #include <vector>
 #include <set>
 #include <algorithm>
 #include <numeric>
+#include <charconv>
+#include <bit>
 
+#include <cstdint>
 #include <cassert>
 
 #include <ProgramOptions/Environment.hpp>
@@ -269,6 +288,16 @@ namespace RandGen {
     }
     return {n,c};
   }
+  // The maximal number of literals in a clause:
+  inline gen_uint_t max_clause_length(const rparam_v& par) noexcept {
+    gen_uint_t res = 0;
+    for (const RParam& pa : par) {
+      gen_uint_t k = 0;
+      for (const ClausePart& cp : pa.cps) k += cp.k;
+      res = std::max(res, k);
+    }
+    return res;
+  }
   std::ostream& operator <<(std::ostream& out, const dimacs_pars pa) {
     return out << "p cnf " << pa.n << " " << pa.c << "\n";
   }
@@ -311,20 +340,24 @@ namespace RandGen {
 
 
   // The global parameters:
-  enum class SortO { filtered=0, sorted=1, unsorted=2 }; // f, s, u
+  enum class SortO { filtered=0, sorted=1, unsorted=2, hashed=3 }; // f, s, u, h
   enum class RenameO { renamed=0, maxindex=1, original=2 }; // r, m, o
 
   typedef std::tuple<SortO,RenameO> option_t;
+  // With the random backend (default RB::mt):
+  typedef std::tuple<SortO,RenameO,RB> extoption_t;
   constexpr char sep = ',';
 
   // Packing both global parameters, providing index-access (with SortO
-  // running fast):
+  // running fast, except of SortO::hashed, which comes last, so that the
+  // indices of the other options (as used in the seeds) are unchanged):
   struct GParam {
     SortO s_;
     RenameO r_;
-    constexpr static int size_s = 3;
+    constexpr static int size_s = 4;
     constexpr static int size_r = 3;
     constexpr static int size = size_s * size_r;
+    constexpr static int size_classical = (size_s-1) * size_r;
     constexpr SortO s() const noexcept { return s_; }
     constexpr RenameO r() const noexcept { return r_; }
 
@@ -332,14 +365,17 @@ namespace RandGen {
     constexpr GParam(const SortO s, const RenameO r) noexcept : s_(s), r_(r) {}
     constexpr GParam(const option_t o) noexcept : s_(std::get<0>(o)), r_(std::get<1>(o)) {}
     explicit constexpr GParam(const int i) :
-      s_(i==-1 ? SortO::unsorted : SortO(i % size_s)),
-      r_(i==-1 ? RenameO::original : RenameO(i / size_s)) {
+      s_(i==-1 ? SortO::unsorted : i >= size_classical ? SortO::hashed :
+         SortO(i % (size_s-1))),
+      r_(i==-1 ? RenameO::original : i >= size_classical ?
+         RenameO(i - size_classical) : RenameO(i / (size_s-1))) {
       if (i < -1) throw std::domain_error("GParam(int): i = " + std::to_string(i) + " < -1");
       if (i >= size) throw std::domain_error("GParam(int): i = " + std::to_string(i) + " >= size");
     }
 
     explicit constexpr operator int() const noexcept {
-      return int(s_) + int(r_) * size_s;
+      if (s_ == SortO::hashed) return size_classical + int(r_);
+      return int(s_) + int(r_) * (size_s-1);
     }
 
     typedef std::pair<SortO,RenameO> pair_t;
@@ -349,7 +385,9 @@ namespace RandGen {
 
   };
 
-  static_assert(GParam::size == 3*3);
+  static_assert(GParam::size == 4*3);
+  static_assert(int(GParam(SortO::unsorted, RenameO::maxindex)) == 5);
+  static_assert(int(GParam(SortO::hashed, RenameO::maxindex)) == 10);
   constexpr bool check_GParam() noexcept {
     for (int i = 0; i < GParam::size; ++i)
       if (int(GParam(i)) != i) return false;
@@ -365,7 +403,7 @@ namespace Environment {
   struct RegistrationPolicies<RandGen::SortO> {
     static constexpr int size = RandGen::GParam::size_s;
     static constexpr std::array<const char*, size> string
-      {"f", "s", "u"};
+      {"f", "s", "u", "h"};
   };
   template <>
   struct RegistrationPolicies<RandGen::RenameO> {
@@ -380,6 +418,7 @@ namespace RandGen {
     switch (s) {
     case SortO::unsorted : return out << "unsorted";
     case SortO::sorted : return out << "sorted";
+    case SortO::hashed : return out << "hashed";
     default : return out << "filtered";}
   }
   std::ostream& operator <<(std::ostream& out, const RenameO r) {
@@ -397,9 +436,12 @@ namespace RandGen {
   struct Param {
     GParam gp;
     rparam_v vp;
+    RB rb = RB::mt;
 
-    Param(const GParam gp, const rparam_v& v) : gp(gp), vp(v) {}
-    Param(const GParam gp, rparam_v&& v) noexcept : gp(gp), vp(v) {}
+    Param(const GParam gp, const rparam_v& v, const RB rb = RB::mt) :
+      gp(gp), vp(v), rb(rb) {}
+    Param(const GParam gp, rparam_v&& v, const RB rb = RB::mt) noexcept :
+      gp(gp), vp(v), rb(rb) {}
   };
 
 
@@ -408,8 +450,6 @@ namespace RandGen {
      ***********************
   */
 
-  const unsigned int default_thread_index = 0;
-
   const gen_uint_t size_type_eseed = 4;
   const gen_uint_t size_cpart_eseed = 2 + 1 + 2;
 
@@ -449,12 +489,18 @@ namespace RandGen {
     v.push_back(gen_uint_t(SeedOrganisation::Logic::block_uniform_cnf));
     v.push_back(gen_uint_t(int(par.gp)));
     v.push_back(par.vp.size());
-    v.push_back(default_thread_index);
+    v.push_back(SeedOrganisation::backend_flag(par.rb));
     assert(v.size() == size_type_eseed);
 
     for (const auto p : par.vp) add_seeds(p,v);
     return v;
   }
+  constexpr gen_uint_t index_backend_eseed = 3;
+  // The backend as given by the seeds:
+  inline RB backend(const vec_eseed_t& s) {
+    assert(s.size() > index_backend_eseed);
+    return SeedOrganisation::backend(s[index_backend_eseed]);
+  }
 
 
   /* ********************************
@@ -567,6 +613,11 @@ namespace RandGen {
   }
 
   typedef std::pair<DimacsClauseList, rename_info_t> RDimacsClauseList;
+  // Moving F (with nested braces, std::pair would copy it):
+  inline RDimacsClauseList make_rdcl(const dimacs_pars dp, ClauseList&& F,
+                                     rename_info_t R = {}) {
+    return std::make_pair(std::make_pair(dp, std::move(F)), std::move(R));
+  }
 
   struct DimacsComments {
     typedef std::vector<std::string> comments_v;
@@ -590,9 +641,50 @@ namespace RandGen {
   // Append a sorted random clause with k literals over the variables from n
   // to the given clause C, with sign-distribution given by p; ignoring
   // the possibility of clashes or duplications w.r.t. the given clauses in C:
+  // For k <= max_small_k, without allocation (besides for C):
+  inline void rand_clause_small(RandGen_t& g, Clause& C, const VarInterval n, const gen_uint_t k, const SignDist p) {
+    assert(k <= max_small_k);
+    small_choice_t varvec;
+    {[[maybe_unused]] const auto size =
+       choose_kn_small(k, n.size(), g, varvec.data(), true);
+     assert(size == k);
+    }
+    if (p.index() == 0) {
+      const Prob64 p0 = std::get<0>(p);
+      if (p0 == Prob64{1,2})
+        for (gen_uint_t i = 0; i < k; ++i)
+          C.push_back({n[varvec[i]], bool2schar(bernoulli_high(g))});
+      else {
+        Bernoulli b(g, p0);
+        for (gen_uint_t i = 0; i < k; ++i)
+          C.push_back({n[varvec[i]], bool2schar(b())});
+      }
+    }
+    else {
+      const gen_uint_t s = std::get<1>(p);
+      assert(s <= k);
+      if (s == k)
+        for (gen_uint_t i = 0; i < k; ++i) C.push_back({n[varvec[i]], 1});
+      else if (s == 0)
+        for (gen_uint_t i = 0; i < k; ++i) C.push_back({n[varvec[i]], -1});
+      else {
+        std::array<signed char, max_small_k> signs; signs.fill(-1);
+        {small_choice_t posvec;
+         [[maybe_unused]] const auto size =
+           choose_kn_small(s, k, g, posvec.data(), true);
+         assert(size == s);
+         for (gen_uint_t i = 0; i < s; ++i) signs[posvec[i]] = 1;
+        }
+        for (gen_uint_t i = 0; i < k; ++i)
+          C.push_back({n[varvec[i]], signs[i]});
+      }
+    }
+  }
+
   inline void rand_clause(RandGen_t& g, Clause& C, const VarInterval n, const gen_uint_t k, const SignDist p) {
     if (k == 0) return;
     assert(k <= n.size());
+    if (k <= max_small_k) { rand_clause_small(g, C, n, k, p); return; }
     const auto varvec = choose_kn(k, n.size(), g, true);
     assert(varvec.size() == k);
     if (p.index() == 0) {
@@ -627,9 +719,12 @@ namespace RandGen {
 
   // Output the created clauses directly on out:
   void rand_clauselist_core(std::ostream& out, RandGen_t& g, const rparam_v& par) {
+    gen_uint_t index = 0;
+    Clause C; C.reserve(max_clause_length(par));
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
-        Clause C; C.reserve(size(pa.cps));
+        g.unit(index++);
+        C.clear();
         for (const ClausePart& cp : pa.cps)
           rand_clause(g, C, cp.n, cp.k, cp.p);
         out << C;
@@ -648,22 +743,25 @@ namespace RandGen {
     ClauseList F;
     const auto [n,c] = extract_parameters(par);
     F.reserve(c);
+    gen_uint_t index = 0;
+    Clause C; C.reserve(max_clause_length(par));
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
-        Clause C; C.reserve(size(pa.cps));
+        g.unit(index++);
+        C.clear();
         for (const ClausePart& cp : pa.cps)
           rand_clause(g, C, cp.n, cp.k, cp.p);
-        F.push_back(std::move(C));
+        F.emplace_back(C.begin(), C.end());
       }
     assert(F.size() == c);
     switch (r) {
-    case RenameO::original : return {{{n,c}, F}, {}};
+    case RenameO::original : return make_rdcl({n,c}, std::move(F));
     case RenameO::maxindex : {
       const auto new_max = max_var_index(F);
-      return {{{new_max,c}, F}, {new_max,{}}};
+      return make_rdcl({new_max,c}, std::move(F), {new_max,{}});
     }
     default : const auto R = rename_clauselist(F);
-              return {{{R.first,c}, F}, R}; }
+              return make_rdcl({R.first,c}, std::move(F), R); }
   }
 
   // Similar to rand_clauselist, but sort the result, and remove duplicated
@@ -673,13 +771,16 @@ namespace RandGen {
     ClauseList F;
     const auto [n,c] = extract_parameters(par);
     F.reserve(c);
+    gen_uint_t index = 0;
+    Clause C; C.reserve(max_clause_length(par));
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
-        Clause C; C.reserve(size(pa.cps));
+        g.unit(index++);
+        C.clear();
         for (const ClausePart& cp : pa.cps)
           rand_clause(g, C, cp.n, cp.k, cp.p);
         std::sort(C.begin(), C.end());
-        F.push_back(std::move(C));
+        F.emplace_back(C.begin(), C.end());
       }
     assert(F.size() == c);
     std::sort(F.begin(), F.end());
@@ -687,14 +788,14 @@ namespace RandGen {
     const auto newc = F.size();
     assert(newc <= c);
     switch (r) {
-    case RenameO::original : return {{{n, newc}, F}, {}};
+    case RenameO::original : return make_rdcl({n, newc}, std::move(F));
     case RenameO::maxindex : {
       const auto new_max = max_var_index(F,true);
-      return {{{new_max, newc}, F}, {new_max,{}}};
+      return make_rdcl({new_max, newc}, std::move(F), {new_max,{}});
     }
     default : const auto R = rename_clauselist(F,true);
               assert(F.size() == newc);
-              return {{{R.first, newc}, F}, R}; }
+              return make_rdcl({R.first, newc}, std::move(F), R); }
   }
 
   // Similar to rand_sortedclauselist, but now reject duplicated clauses
@@ -707,15 +808,17 @@ namespace RandGen {
     // Testing whether there is enough memory (temporary solution; better
     // to use a custome-allocator, which actually uses the allocated memory):
     F.get_allocator().deallocate(F.get_allocator().allocate(c), c);
+    gen_uint_t index = 0;
+    Clause C; C.reserve(max_clause_length(par));
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
-        Clause C; C.reserve(size(pa.cps));
+        g.unit(index++);
         do {
           C.clear();
           for (const ClausePart& cp : pa.cps)
             rand_clause(g, C, cp.n, cp.k, cp.p);
           std::sort(C.begin(), C.end());
-        } while (not F.insert(std::move(C)).second);
+        } while (not F.insert(C).second);
       }
     assert(F.size() == c);
     ClauseList F2;
@@ -726,13 +829,210 @@ namespace RandGen {
     // reasonable to expect:
     assert(F.empty() and F2.size() == c);
     switch (r) {
-    case RenameO::original : return {{{n,c}, F2}, {}};
+    case RenameO::original : return make_rdcl({n,c}, std::move(F2));
     case RenameO::maxindex : {
       const auto new_max = max_var_index(F2,true);
-      return {{{new_max,c}, F2}, {new_max,{}}};
+      return make_rdcl({new_max,c}, std::move(F2), {new_max,{}});
     }
     default : const auto R = rename_clauselist(F2,true);
-              return {{{R.first,c}, F2}, R}; }
+              return make_rdcl({R.first,c}, std::move(F2), R); }
+  }
+
+
+  /* Clause-lists without duplicates, for SortO::hashed:
+      - the (sorted) clauses are stored in the order of insertion, packed
+        into one arena (literal (v,s) as 2v+s), with offsets[i] the start
+        of clause i;
+      - the open-addressing hash-table (linear probing, load-factor at
+        most 1/2) holds the clause-indices plus one (0 for empty), as
+        32-bit numbers (so at most max_size clauses).
+     So a clause with k literals needs 8k + 8 + 8 bytes (for c clauses
+     reserved ahead, otherwise up to 16 bytes for the table), compared to
+     around 100 + 16k bytes for std::set<Clause> (with additionally the
+     resulting ClauseList).
+  */
+  class HashedClauseList {
+  public :
+    typedef std::uint64_t packed_t;
+    typedef std::uint64_t index_t;
+    typedef std::vector<packed_t> arena_t;
+    typedef std::uint32_t entry_t;
+    typedef std::vector<entry_t> table_t;
+    static constexpr index_t max_size = std::numeric_limits<entry_t>::max() - 1;
+
+    static constexpr packed_t pack(const Lit x) noexcept {
+      return 2 * x.v.v + x.s;
+    }
+    static constexpr Lit unpack(const packed_t p) noexcept {
+      return {bool(p % 2), Var(p / 2)};
+    }
+
+    HashedClauseList() { offsets.push_back(0); }
+    // c clauses with altogether l literals are expected:
+    void reserve(const index_t c, const index_t l) {
+      if (c > max_size)
+        throw std::domain_error("HashedClauseList::reserve: c = " +
+                                std::to_string(c) + " > max_size");
+      arena.reserve(l); offsets.reserve(c+1);
+      if (2*c > table.size()) rehash(table_size(c));
+    }
+
+    index_t size() const noexcept { return offsets.size() - 1; }
+    index_t length(const index_t i) const noexcept {
+      assert(i < size());
+      return offsets[i+1] - offsets[i];
+    }
+    const packed_t* begin(const index_t i) const noexcept {
+      assert(i < size());
+      return arena.data() + offsets[i];
+    }
+
+    // C must be sorted; returns true iff C was new:
+    bool insert(const Clause& C) {
+      assert(std::is_sorted(C.begin(), C.end()));
+      if (size() == max_size)
+        throw std::domain_error("HashedClauseList::insert: max_size reached");
+      if (2 * (size()+1) > table.size()) rehash(table_size(size()+1));
+      const index_t start = arena.size();
+      for (const Lit x : C) arena.push_back(pack(x));
+      const index_t mask = table.size() - 1;
+      for (index_t j = hash(arena.data()+start, C.size()) & mask; ;
+           j = (j+1) & mask) {
+        const index_t t = table[j];
+        if (t == 0) {
+          table[j] = entry_t(size() + 1);
+          offsets.push_back(arena.size());
+          return true;
+        }
+        if (equal(t-1, arena.data()+start, C.size())) {
+          arena.resize(start);
+          return false;
+        }
+      }
+    }
+
+    // Releasing the hash-table (no further insertions possible):
+    void finish() noexcept { table_t().swap(table); }
+
+    gen_uint_t max_var_index() const noexcept {
+      packed_t max = 0;
+      for (const packed_t p : arena) max = std::max(max, p);
+      return max / 2;
+    }
+    // As rename_clauselist:
+    rename_info_t rename() {
+      const gen_uint_t old_max = max_var_index();
+      assert(old_max + 1 != 0);
+      rename_vt indices(old_max+1);
+      for (const packed_t p : arena) indices[p/2] = 1;
+      gen_uint_t new_max = 0;
+      for (gen_uint_t i = 1; i <= old_max; ++i)
+        if (indices[i] == 1) indices[i] = ++new_max;
+      for (packed_t& p : arena) p = 2 * indices[p/2] + p % 2;
+      return {new_max, indices};
+    }
+
+    ClauseList clauselist() const {
+      ClauseList F; F.reserve(size());
+      for (index_t i = 0; i < size(); ++i) {
+        Clause C; C.reserve(length(i));
+        for (const packed_t* p = begin(i); p != begin(i)+length(i); ++p)
+          C.push_back(unpack(*p));
+        F.push_back(std::move(C));
+      }
+      return F;
+    }
+
+    friend std::ostream& operator <<(std::ostream& out,
+                                     const HashedClauseList& F) {
+      constexpr std::size_t bufsize = 1 << 20, max_chars = 22;
+      std::vector<char> buf(bufsize + 2);
+      char* q = buf.data();
+      const auto flush = [&]{ out.write(buf.data(), q - buf.data());
+                              q = buf.data(); };
+      for (index_t i = 0; i < F.size(); ++i) {
+        for (const packed_t* p = F.begin(i); p != F.begin(i)+F.length(i); ++p) {
+          if (std::size_t(q - buf.data()) + max_chars > bufsize) flush();
+          if (*p % 2 == 0) *q++ = '-';
+          q = std::to_chars(q, q + 20, *p / 2).ptr;
+          *q++ = ' ';
+        }
+        *q++ = '0'; *q++ = '\n';
+        if (std::size_t(q - buf.data()) + max_chars > bufsize) flush();
+      }
+      flush();
+      return out;
+    }
+
+  private :
+    arena_t arena;
+    std::vector<index_t> offsets;
+    table_t table;
+
+    static index_t table_size(const index_t c) noexcept {
+      return std::bit_ceil(std::max(index_t(8), 2*c));
+    }
+    static index_t hash(const packed_t* const C, const index_t k) noexcept {
+      index_t h = mix64(k);
+      for (index_t i = 0; i < k; ++i) h = mix64(h ^ C[i]);
+      return h;
+    }
+    bool equal(const index_t i, const packed_t* const C,
+               const index_t k) const noexcept {
+      return length(i) == k and std::equal(C, C+k, begin(i));
+    }
+    void rehash(const index_t s) {
+      assert(std::has_single_bit(s) and s >= 2*size());
+      table_t T(s);
+      const index_t mask = s - 1;
+      for (index_t i = 0; i < size(); ++i) {
+        index_t j = hash(begin(i), length(i)) & mask;
+        while (T[j] != 0) j = (j+1) & mask;
+        T[j] = entry_t(i+1);
+      }
+      table.swap(T);
+    }
+  };
+
+  typedef std::pair<std::pair<dimacs_pars, HashedClauseList>, rename_info_t>
+    RHashedClauseList;
+
+  // Similar to rand_clauseset, but now the clauses are kept in the order
+  // of creation (each clause sorted), and duplicates are rejected via
+  // HashedClauseList:
+  RHashedClauseList rand_hashedclauselist(RandGen_t& g, const rparam_v& par, const RenameO r = RenameO::original) {
+    HashedClauseList F;
+    const auto [n,c] = extract_parameters(par);
+    {gen_uint_t l = 0;
+     for (const RParam& pa : par)
+       for (const ClausePart& cp : pa.cps) l += pa.c * cp.k;
+     F.reserve(c, l);
+    }
+    gen_uint_t index = 0;
+    Clause C; C.reserve(max_clause_length(par));
+    for (const RParam& pa : par)
+      for (gen_uint_t i = 0; i < pa.c; ++i) {
+        g.unit(index++);
+        do {
+          C.clear();
+          for (const ClausePart& cp : pa.cps)
+            rand_clause(g, C, cp.n, cp.k, cp.p);
+          std::sort(C.begin(), C.end());
+        } while (not F.insert(C));
+      }
+    assert(F.size() == c);
+    F.finish();
+    const auto make = [&F](const dimacs_pars dp, rename_info_t R) {
+      return std::make_pair(std::make_pair(dp, std::move(F)), std::move(R));
+    };
+    switch (r) {
+    case RenameO::original : return make({n,c}, {});
+    case RenameO::maxindex : {
+      const auto new_max = F.max_var_index();
+      return make({new_max,c}, {new_max,{}});
+    }
+    default : auto R = F.rename();
+              return make({R.first,c}, std::move(R)); }
   }
 
   RDimacsClauseList random(RandGen_t& g, const Param& par) {
@@ -740,6 +1040,9 @@ namespace RandGen {
     switch (spar) {
     case SortO::unsorted : return rand_clauselist(g, par.vp, rpar);
     case SortO::sorted : return rand_sortedclauselist(g, par.vp, rpar);
+    case SortO::hashed : {
+      auto [dF, R] = rand_hashedclauselist(g, par.vp, rpar);
+      return make_rdcl(dF.first, dF.second.clauselist(), std::move(R)); }
     default : return rand_clauseset(g, par.vp, rpar); }
   }
 
@@ -26,6 +26,8 @@ License, or any later version. */
    Seed-handling:
 
      - vec_eseed_t seeds(Param, block_v, dep_par_t)
+     - dependencies_unit is the unit of the random generator for the
+       dependencies (the clauses use the units 0, 1, ...).
 
    Tools for the generation-process:
 
@@ -215,7 +217,7 @@ namespace RandGen {
     v.push_back(gen_uint_t(SeedOrganisation::Logic::block_uniform_dqcnf));
     v.push_back(gen_uint_t(int(par.gp)));
     v.push_back(par.vp.size());
-    v.push_back(default_thread_index);
+    v.push_back(SeedOrganisation::backend_flag(par.rb));
     assert(v.size() == first);
 
     v.push_back(gen_uint_t(int(dep.second)));
@@ -232,6 +234,9 @@ namespace RandGen {
     return v;
   }
 
+  // For backend RB::xo the dependencies use their own sub-stream:
+  constexpr gen_uint_t dependencies_unit = randgen_max;
+
 
   // The original interval and the shifted interval:
   typedef std::pair<VarInterval, VarInterval> orig_new_pair;
@@ -390,6 +395,7 @@ namespace RandGen {
     }
 
     assert(ne != 0);
+    g.unit(dependencies_unit);
     switch (deppar.second) {
     case DepOp::from_scratch: {
       const dep_edges rdep = translate(choose_kn(deppar.first, na*ne, g, true), na, ne, bv, DepOp::from_scratch);
@@ -569,7 +575,7 @@ namespace RandGen {
   FullDependencies create_dependencies(const dep_edges& rdep, const block_v& bv, const DepOp dpo) {
     assert(valid(bv));
     const gen_uint_t n = bv[0].v.b();
-    FullDependencies R{{},n+1};
+    FullDependencies R{{}, Dvector(n+1)};
     if (dpo == DepOp::from_scratch) {
       gen_uint_t ei = 0;
       auto dep_it = rdep.cbegin();
@@ -638,6 +644,7 @@ namespace RandGen {
   FullDependencies create_dependencies(RandGen_t& g, const block_v& bv, const gen_uint_t na, const gen_uint_t ne, const dep_par_t deppar) {
     assert(valid(bv));
     assert(deppar.second==DepOp::from_scratch or deppar.second==DepOp::subtract or deppar.second==DepOp::add);
+    g.unit(dependencies_unit);
     return create_dependencies(translate(choose_kn(deppar.first,
       deppar.second==DepOp::from_scratch ? na*ne
         : (deppar.second==DepOp::subtract ? num_dependencies(bv) : na*ne-num_dependencies(bv)),
@@ -655,7 +662,7 @@ namespace RandGen {
     assert(max >= 1);
     assert(size2 >= max);
 
-    FullDependencies res{{}, max+1};
+    FullDependencies res{{}, Dvector(max+1)};
     std::map<Dependency, Dependency> old2new;
     for (const AVarset& V : ds) {
       const Dependency olddep = &V;
@@ -148,8 +148,8 @@ TODOS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.13.0",
-        "8.5.2021",
+        "0.14.0",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann and Oleg Zaikin",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/LSRG.cpp",
@@ -173,6 +173,7 @@ namespace {
     "           : " << Environment::WRP<LS::StRLS>{} << "\n"
     "           : " << Environment::WRP<EncO>{} << "\n"
     "           : " << Environment::WRP<ForO>{} << "\n"
+    "           : " << Environment::WRP<RG::RB>{} << "\n"
     " selection : k=1:\n"
     "               r,c,s with r,c in [0,N], s in [0,N^2], r*c+s <= N^2,\n"
     "               default = N,N,0 = 0,0,N*N\n"
@@ -210,6 +211,7 @@ int main(const int argc, const char* const argv[]) {
   const LS::StRLS sto = std::get<LS::StRLS>(options);
   const EncO eo = std::get<EncO>(options);
   const ForO fo = std::get<ForO>(options);
+  const RG::RB rb = std::get<RG::RB>(options);
 
   const selection_vt sel = argc <= index ?
     toSelection(D, "", error) : toSelection(D, argv[index++], error);
@@ -217,7 +219,7 @@ int main(const int argc, const char* const argv[]) {
 
   // The seed-string:
   const std::string ss = argc <= index ? "" : argv[index++];
-  auto seeds = basic_seeds(D, sel, geo, sto);
+  auto seeds = basic_seeds(D, sel, geo, sto, rb);
   const RG::gen_uint_t basic_size = seeds.size();
   SO::add_user_seeds(seeds, ss);
 
@@ -267,8 +269,9 @@ int main(const int argc, const char* const argv[]) {
     out << DWW{"gen-option"} << geo << "\n"
         << DWW{"std-option"} << sto << "\n"
         << DWW{"encoding-option"} << eo << "\n"
-        << DWW{"format-option"} << fo << "\n"
-        << DWW{"selection"} << sel[0];
+        << DWW{"format-option"} << fo << "\n";
+    if (rb != RG::RB::mt) out << DWW{"backend"} << rb << "\n";
+    out << DWW{"selection"} << sel[0];
     for (RG::gen_uint_t i = 1; i < sel.size(); ++i)
       out << ";" << sel[i];
     out << "\n"
@@ -283,7 +286,7 @@ int main(const int argc, const char* const argv[]) {
     out << "c " <<  RG::ESW{seeds} << "\n";
 
   if (D.k == 1) {
-    const auto L = random_ls(D.N, sel[0], geo, sto, seeds);
+    const auto L = random_ls(D.N, sel[0], geo, sto, seeds, rb);
     if (eo == EncO::ls) out << LS::LS_t{L};
     else dimacs_output(out, L);
   }
@@ -293,9 +296,12 @@ int main(const int argc, const char* const argv[]) {
       return 1;
     }
     out << D.N << " " << D.k << "\n\n";
-    RG::RandGen_t g(seeds);
+    // For RB::xo square i is a pure function of the seeds and i:
+    RG::RandGen_t g(seeds, rb);
     out << LS::LS_t{random_ls(D.N, sel[0], geo, sto, g)};
-    for (RG::gen_uint_t i = 1; i < D.k; ++i)
+    for (RG::gen_uint_t i = 1; i < D.k; ++i) {
+      g.unit(i);
       out << "\n" << LS::LS_t{random_ls(D.N, sel[i], geo, sto, g)};
+    }
   }
 }
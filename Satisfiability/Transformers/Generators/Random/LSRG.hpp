@@ -10,14 +10,16 @@ License, or any later version. */
   General definitions regarding the generator LSRG for random latin squares
 
    - enum classes GenO, EncO, ForO, with registration
-   - option_t
+   - option_t (including the random backend RandGen::RB)
    - toSelection(N, string)
    - enum class (lsrg_variant) (for the variations)
 
-   - basic_seeds(lsrg_variant, N, selection, go, so)
+   - basic_seeds(lsrg_variant, N, selection, go, so, rb): for rb = RB::xo
+     the backend-flag is the third generic parameter (for RB::mt there are
+     only two, so that the seeds are as before)
 
    - random_ls(N, selection, go, so, generator)
-   - random_ls(N, selection, go, so, seed-vector)
+   - random_ls(N, selection, go, so, seed-vector, rb)
 
    - lsrg_t (triple of ls_t, vec_eseed_t, gen_uint_t)
    - random_ls(lsrg_variant, N, seed-string, selection, go, so)
@@ -89,7 +91,7 @@ namespace LSRG {
   enum class ForO {wc=0, nco=1, os=2};
 
   constexpr char sep = ',';
-  typedef std::tuple<LS::StRLS, GenO, EncO, ForO> option_t;
+  typedef std::tuple<LS::StRLS, GenO, EncO, ForO, RandGen::RB> option_t;
 
 }
 namespace Environment {
@@ -299,7 +301,7 @@ namespace LSRG {
   }
 
 
-  RG::vec_eseed_t basic_seeds(const Dim& D, const selection_vt& sel, const GenO go, const LS::StRLS so) {
+  RG::vec_eseed_t basic_seeds(const Dim& D, const selection_vt& sel, const GenO go, const LS::StRLS so, const RG::RB rb = RG::RB::mt) {
     assert(valid(D));
     RG::vec_eseed_t res = SO::initial_seeding(
         SO::OKlibrary_timestamp,
@@ -308,10 +310,13 @@ namespace LSRG {
         SO::lsrg_timestamp,
         SO::eseed_t(D.v));
     using SO::eseed_t;
+    RG::vec_eseed_t gen{eseed_t(go), eseed_t(so)};
+    if (rb != RG::RB::mt) {
+      gen.push_back(SO::backend_flag(rb)); ++res.back();
+    }
     if (D.v == lsrg_variant::basic) {
       const eseed_t size_spec_params = 1 + 3;
-      SO::add_generic_parameters(res,
-                                 {eseed_t(go), eseed_t(so)}, size_spec_params);
+      SO::add_generic_parameters(res, gen, size_spec_params);
       assert(sel.size() == 1);
       const auto& s = sel.front();
       SO::add_specific_parameters(res, {D.N, s.r,s.c,s.s});
@@ -319,8 +324,7 @@ namespace LSRG {
     else {
       assert(D.v == lsrg_variant::with_k);
       const eseed_t size_spec_params = 2 + 3*D.k;
-      SO::add_generic_parameters(res,
-                                 {eseed_t(go), eseed_t(so)}, size_spec_params);
+      SO::add_generic_parameters(res, gen, size_spec_params);
       assert(sel.size() == D.k);
       RG::vec_eseed_t add; add.reserve(size_spec_params);
       add.push_back(D.N); add.push_back(D.k);
@@ -337,12 +341,12 @@ namespace LSRG {
     switch (go) {
     case GenO::majm :
       return LS::select(LS::standardise(
-        LS::lsip2ls(LS::jm(LS::full_shuffle(
+        LS::jm_ls(LS::full_shuffle(
           LS::random_ma_ls(N, LS::CrRLS::with_initial_phase, g), g),
-          g)), so), sel, g);
+          g), so), sel, g);
     case GenO::jm :
       return LS::select(LS::standardise(
-        LS::lsip2ls(LS::jm(N, g)), so), sel, g);
+        LS::jm_ls(N, g), so), sel, g);
     case GenO::ma :
       return LS::select(LS::standardise(
         LS::random_ma_ls(N, LS::CrRLS::with_initial_phase, g), so), sel, g);
@@ -352,8 +356,9 @@ namespace LSRG {
 
   LS::ls_t random_ls(const LS::ls_dim_t N, const LS::Selection& sel,
                      const GenO go, const LS::StRLS so,
-                     const RG::vec_eseed_t& seeds) {
-    RG::RandGen_t g(seeds);
+                     const RG::vec_eseed_t& seeds,
+                     const RG::RB rb = RG::RB::mt) {
+    RG::RandGen_t g(seeds, rb);
     return random_ls(N, {sel}, go, so, g);
   }
 
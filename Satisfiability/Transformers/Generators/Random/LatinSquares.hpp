@@ -178,6 +178,15 @@ License, or any later version. */
    - jm(ls_dim_t, RandGen)
    - jm(ls_t, RandGen)
 
+     with constant-time steps (the same results as above):
+   - class JMState (the ones of all lines, and the possible improper cell)
+   - jm_next(JMState&, RandGen)
+   - jm_ls(ls_dim_t, RandGen)
+   - jm_ls(ls_t, RandGen)
+
+   - jm_batch(ls_dim_t, count, RandGen, threads) (count independent squares,
+     square i using sub-stream i, computed by threads)
+
 
   Sub-latin-squares:
 
@@ -227,6 +236,8 @@ TODOS:
 #include <utility>
 #include <optional>
 #include <iomanip>
+#include <thread>
+#include <atomic>
 
 #include <cassert>
 #include <cstdint>
@@ -1246,6 +1257,163 @@ namespace LatinSquares {
   }
 
 
+  /* The Jacobson-Matthews generator with constant-time steps
+
+     Above each step needs to scan up to 6 lines of length N (and ls_ip_t
+     with its N^3 entries is scattered over memory). Instead JMState stores
+     for each line its 1-entry, in three N*N-arrays:
+      - l[0][y*N+z] = x with I[x][y][z] = 1 (line (.,y,z))
+      - l[1][x*N+z] = y with I[x][y][z] = 1 (line (x,.,z))
+      - l[2][x*N+y] = z with I[x][y][z] = 1 (line (x,y,.)).
+     In the improper case, with m the cell having value -1, the three
+     lines through m have two 1-entries, and the other ones are s[0],
+     s[1], s[2]. Then a step (and thus jm_next) runs in constant time
+     (besides the loop of find_zero), and uses the random generator in
+     exactly the same way as for ls_ip_t, yielding the same results.
+  */
+
+  class JMState {
+    ls_dim_t N_;
+    std::array<std::vector<ls_dim_t>, 3> l;
+    bool proper_ = true;
+    triple_t m{}, s{};
+
+    std::uint64_t ind(const ls_dim_t a, const ls_dim_t b) const noexcept {
+      return std::uint64_t(a) * N_ + b;
+    }
+
+    // Completing the move from r to o (the lines not through r):
+    void complete(const triple_t r, const triple_t o) noexcept {
+      const auto [rx, ry, rz] = r;
+      const auto [ox, oy, oz] = o;
+      l[2][ind(rx,oy)] = oz; l[2][ind(ox,ry)] = oz;
+      l[1][ind(rx,oz)] = oy; l[1][ind(ox,rz)] = oy;
+      l[0][ind(oy,rz)] = ox; l[0][ind(ry,oz)] = ox;
+      if (l[2][ind(ox,oy)] == oz) {
+        l[2][ind(ox,oy)] = rz; l[1][ind(ox,oz)] = ry; l[0][ind(oy,oz)] = rx;
+        proper_ = true;
+      }
+      else { proper_ = false; m = o; s = r; }
+    }
+
+  public :
+
+    explicit JMState(const ls_t& L) : N_(L.size()) {
+      assert(valid(L));
+      for (auto& v : l) v.resize(std::uint64_t(N_) * N_);
+      for (ls_dim_t x = 0; x < N_; ++x)
+        for (ls_dim_t y = 0; y < N_; ++y) {
+          const ls_dim_t z = L[x][y];
+          l[0][ind(y,z)] = x; l[1][ind(x,z)] = y; l[2][ind(x,y)] = z;
+        }
+    }
+
+    ls_dim_t N() const noexcept { return N_; }
+    bool proper() const noexcept { return proper_; }
+
+    // As find_zero(ls_ip_t, RandGen):
+    triple_t find_zero(RG::RandGen_t& g) const noexcept {
+      assert(proper_);
+      RG::UniformRange U(g, N_);
+      ls_dim_t i, j, k;
+      do { i = U(); j = U(); k = U(); }
+      while (l[2][ind(i,j)] == k);
+      return {i,j,k};
+    }
+    // The move from the proper state, for the 0-entry r:
+    void move(const triple_t r) noexcept {
+      assert(proper_);
+      const auto [rx, ry, rz] = r;
+      const triple_t o{l[0][ind(ry,rz)], l[1][ind(rx,rz)], l[2][ind(rx,ry)]};
+      l[0][ind(ry,rz)] = rx; l[1][ind(rx,rz)] = ry; l[2][ind(rx,ry)] = rz;
+      complete(r, o);
+    }
+    // The move from the improper state (as find_both_ones(ls_ip_t, m)
+    // followed by move(ls_ip_t&, m, o)):
+    void move(RG::RandGen_t& g) noexcept {
+      assert(not proper_);
+      const auto [rx, ry, rz] = m;
+      const std::array<std::uint64_t, 3> li{ind(ry,rz), ind(rx,rz), ind(rx,ry)};
+      triple_t o;
+      for (ls_dim_t i = 0; i < 3; ++i) {
+        const auto [a,b] = std::minmax(l[i][li[i]], s[i]);
+        const bool c = RG::bernoulli(g);
+        o[i] = c ? b : a; l[i][li[i]] = c ? a : b;
+      }
+      complete(m, o);
+    }
+
+    ls_t ls() const {
+      assert(proper_);
+      ls_t res(N_, ls_row_t(N_));
+      for (ls_dim_t x = 0; x < N_; ++x)
+        std::copy(l[2].begin() + ind(x,0), l[2].begin() + ind(x+1,0),
+                  res[x].begin());
+      return res;
+    }
+    ls_ip_t ip() const {
+      ls_ip_t res = create_ip(N_);
+      for (ls_dim_t x = 0; x < N_; ++x)
+        for (ls_dim_t y = 0; y < N_; ++y) res[x][y][l[2][ind(x,y)]] = 1;
+      if (not proper_) {
+        const auto [mx, my, mz] = m;
+        res[mx][my][mz] = -1;
+        res[s[0]][my][mz] = 1; res[mx][s[1]][mz] = 1; res[mx][my][s[2]] = 1;
+      }
+      return res;
+    }
+  };
+
+  // As jm_next(ls_ip_t&, RandGen):
+  std::uint64_t jm_next(JMState& S, RG::RandGen_t& g) noexcept {
+    assert(S.proper());
+    if (S.N() == 1) return 0;
+    std::uint64_t count = 0;
+    S.move(S.find_zero(g));
+    for (; not S.proper(); ++count) S.move(g);
+    return count;
+  }
+
+  ls_t jm_ls(const ls_dim_t N, RG::RandGen_t& g) {
+    const auto rounds = jm_rounds(N, g);
+    JMState S(cyclic_ls(N));
+    for (std::uint64_t i = 0; i < rounds; ++i) jm_next(S, g);
+    return S.ls();
+  }
+  ls_t jm_ls(const ls_t& L, RG::RandGen_t& g) {
+    assert(valid(L));
+    const ls_dim_t N = L.size();
+    const auto rounds = jm_rounds(N, g);
+    JMState S(L);
+    for (std::uint64_t i = 0; i < rounds; ++i) jm_next(S, g);
+    return S.ls();
+  }
+
+  /* The generator g must use the backend RB::xo; square i is
+     jm_ls(N, h) for h = g.unit(i) (on a copy of g), and thus the result is
+     independent of the number of threads; the squares are distributed
+     dynamically to the threads (one at a time).
+  */
+  inline std::vector<ls_t> jm_batch(const ls_dim_t N, const std::uint64_t count, const RG::RandGen_t& g, const unsigned threads) {
+    assert(g.backend() == RG::RB::xo);
+    assert(threads >= 1);
+    std::vector<ls_t> res(count);
+    std::atomic<std::uint64_t> next = 0;
+    const auto work = [&]{
+      RG::RandGen_t h(g);
+      for (std::uint64_t i; (i = next++) < count;) {
+        h.unit(i);
+        res[i] = jm_ls(N, h);
+      }
+    };
+    const std::uint64_t T = std::min(std::uint64_t(threads), count);
+    std::vector<std::thread> workers; workers.reserve(T);
+    for (std::uint64_t t = 0; t < T; ++t) workers.emplace_back(work);
+    for (std::thread& t : workers) t.join();
+    return res;
+  }
+
+
   // Construct selection-object by giving the number of selected rows, columns,
   // and additional single cells, stores for rows and columns the
   // number of deletions:
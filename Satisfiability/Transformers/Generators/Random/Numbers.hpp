@@ -77,10 +77,19 @@ License, or any later version. */
      - explanation_seeds(out, indent) outputs a standardised help-text.
 
 
+    - The second backend, counter-based:
+     - mix64(x) is the SplitMix64-finaliser
+     - xoshiro256_t is the xoshiro256** engine
+     - substream(key, i) is the xoshiro256_t-state for unit i, a pure
+       function of key and i (so jumping to unit i is constant-time).
+
     - RandGen_t is a wrapper around randgen_t, allowing only initialisation
       with vec_seed_t, vec_eseed_t, or a list of seed_t: the direct
       initialisation with a single seed is not allowed (to avoid weak seeds,
       and unknowlingly duplicated runs).
+     - The backend is selected by the scoped enum RB (mt, xo); with RB::xo,
+       unit(i) sets the state to substream i (for clause i, square i etc.),
+       while for RB::mt unit(i) does nothing (sequential generation).
 
     - Prob64 is a simple type for precise probabilities, based on fractions of
       unsigned 64-bit integers:
@@ -135,6 +144,8 @@ TODOS:
 #define NUMBERS_ABopVoYw
 
 #include <random>
+#include <array>
+#include <bit>
 #include <type_traits>
 #include <limits>
 #include <vector>
@@ -448,6 +459,94 @@ namespace RandGen {
   }
 
 
+  /* The counter-based backend */
+
+  inline constexpr gen_uint_t mix64(gen_uint_t z) noexcept {
+    z += 0x9E37'79B9'7F4A'7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EBULL;
+    return z ^ (z >> 31);
+  }
+  static_assert(mix64(0) == 0xE220'A839'7B1D'CDAFULL);
+
+  // xoshiro256** by D. Blackman and S. Vigna (https://prng.di.unimi.it/):
+  class xoshiro256_t {
+  public :
+    typedef gen_uint_t result_type;
+    typedef std::array<gen_uint_t, 4> state_t;
+  private :
+    state_t s_;
+  public :
+    static constexpr gen_uint_t min() noexcept {return 0;}
+    static constexpr gen_uint_t max() noexcept {return randgen_max;}
+
+    // The state must not be all-zero:
+    constexpr explicit xoshiro256_t(const state_t& s) noexcept : s_(s) {
+      assert(s_ != state_t{});
+    }
+    constexpr xoshiro256_t() noexcept : s_{mix64(0), mix64(1), mix64(2), mix64(3)} {}
+
+    constexpr const state_t& state() const noexcept { return s_; }
+
+    constexpr gen_uint_t operator ()() noexcept {
+      const gen_uint_t res = std::rotl(s_[1] * 5, 7) * 9;
+      const gen_uint_t t = s_[1] << 17;
+      s_[2] ^= s_[0]; s_[3] ^= s_[1]; s_[1] ^= s_[2]; s_[0] ^= s_[3];
+      s_[2] ^= t; s_[3] = std::rotl(s_[3], 45);
+      return res;
+    }
+    constexpr void discard(unsigned long long z) noexcept {
+      for (; z != 0; --z) operator()();
+    }
+
+    friend constexpr bool operator ==(const xoshiro256_t&, const xoshiro256_t&) noexcept = default;
+    friend std::ostream& operator <<(std::ostream& out, const xoshiro256_t& g) {
+      return out << g.s_[0] << " " << g.s_[1] << " " << g.s_[2] << " " << g.s_[3];
+    }
+  };
+
+  // The state for unit i of the counter-based backend with the given key:
+  inline constexpr xoshiro256_t::state_t substream(const xoshiro256_t::state_t& key, const gen_uint_t i) noexcept {
+    const gen_uint_t c = mix64(i);
+    xoshiro256_t::state_t s;
+    for (unsigned j = 0; j < 4; ++j)
+      s[j] = mix64(key[j] ^ (c + j * 0x9E37'79B9'7F4A'7C15ULL));
+    if (s == xoshiro256_t::state_t{}) s[0] = 1;
+    return s;
+  }
+
+  // The key for the counter-based backend, from a sequence of seeds:
+  inline xoshiro256_t::state_t init_key(const vec_seed_t& v) {
+    std::seed_seq s(v.begin(), v.end());
+    std::array<seed_t, 8> a;
+    s.generate(a.begin(), a.end());
+    xoshiro256_t::state_t key;
+    for (unsigned j = 0; j < 4; ++j)
+      key[j] = gen_uint_t(a[2*j]) | (gen_uint_t(a[2*j+1]) << 32);
+    return key;
+  }
+
+
+  // The random backends: the Mersenne Twister, or xoshiro256** with
+  // sub-streams:
+  enum class RB { mt=0, xo=1 };
+}
+namespace Environment {
+  template <>
+  struct RegistrationPolicies<RandGen::RB> {
+    static constexpr int size = int(RandGen::RB::xo)+1;
+    static constexpr std::array<const char*, size> string
+      {"mt", "xo"};
+  };
+}
+namespace RandGen {
+  std::ostream& operator <<(std::ostream& out, const RB b) {
+    switch (b) {
+    case RB::xo : return out << "xoshiro-substreams";
+    default : return out << "mersenne-twister";}
+  }
+
+
   /* Wrapper around random-generator g, providing initialisation with
      a sequence of seeds only.
 
@@ -461,21 +560,47 @@ namespace RandGen {
      words, first the lower-order part).
      Default-initalisation is the same as initialisation with an
      empty vector (32- or 64-bit).
+
+     With backend RB::xo, the seeds yield the key for the sub-streams
+     (and the initial state is that of unit 0).
   */
   class RandGen_t {
+    RB b_ = RB::mt;
     randgen_t g_;
+    xoshiro256_t x_;
+    xoshiro256_t::state_t key_{};
+
+    RandGen_t(const vec_seed_t& v, const RB b) :
+      b_(b), g_(b == RB::mt ? init(v) : randgen_t()) {
+      if (b == RB::xo) {
+        key_ = init_key(v);
+        x_ = xoshiro256_t(substream(key_, 0));
+      }
+    }
   public :
     static constexpr gen_uint_t min() noexcept {return 0;}
     static constexpr gen_uint_t max() noexcept {return randgen_max;}
-    void discard(unsigned long long z) noexcept {g_.discard(z);}
-    gen_uint_t operator ()() noexcept { return g_(); }
+    void discard(unsigned long long z) noexcept {
+      if (b_ == RB::mt) g_.discard(z); else x_.discard(z);
+    }
+    gen_uint_t operator ()() noexcept {
+      return b_ == RB::mt ? g_() : x_();
+    }
+
+    RB backend() const noexcept { return b_; }
+    // Starting unit i (a pure function of the seeds and i for RB::xo):
+    void unit(const gen_uint_t i) noexcept {
+      if (b_ == RB::xo) x_ = xoshiro256_t(substream(key_, i));
+    }
 
-    randgen_t extract() const noexcept { return g_; }
+    randgen_t extract() const noexcept { assert(b_ == RB::mt); return g_; }
 
     explicit RandGen_t() noexcept : g_(init({})) {};
     explicit RandGen_t(const vec_seed_t& v) : g_(init(v)) {}
     RandGen_t(std::initializer_list<seed_t> l) : g_(init(l)) {}
     RandGen_t(const vec_eseed_t& v) : RandGen_t(transform(v, SP::split)) {}
+    RandGen_t(const vec_eseed_t& v, const RB b) :
+      RandGen_t(transform(v, SP::split), b) {}
 
     explicit RandGen_t(const RandGen_t&) noexcept = default;
     explicit RandGen_t(RandGen_t&&) noexcept = default;
@@ -483,13 +608,16 @@ namespace RandGen {
     RandGen_t& operator =(RandGen_t&&) noexcept = default;
 
     friend bool operator ==(const RandGen_t& lhs, const RandGen_t& rhs) noexcept {
-      return lhs.g_ == rhs.g_;
+      if (lhs.b_ != rhs.b_) return false;
+      if (lhs.b_ == RB::mt) return lhs.g_ == rhs.g_;
+      return lhs.x_ == rhs.x_ and lhs.key_ == rhs.key_;
     }
     friend bool operator !=(const RandGen_t& l, const RandGen_t& r) noexcept {
       return not (l == r);
     }
     friend std::ostream& operator <<(std::ostream& out, const RandGen_t& g) {
-      return out << g.g_;
+      if (g.b_ == RB::mt) return out << g.g_;
+      else return out << g.x_;
     }
 
   };
@@ -0,0 +1,181 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Parallel generation of block-uniform clause-lists (for BRG)
+
+   - append(char*, Clause) writes the Dimacs-form of a clause via
+     std::to_chars, returning the new end
+   - max_clause_chars(rparam_v) is an upper bound on the length of the
+     output of a single clause
+   - default_blocksize(rparam_v) is the number of clauses per block such
+     that a block has at most max_block_chars characters
+
+   - rand_clauselist_core(out, g, par, threads, blocksize) outputs the
+     clauses (without the Dimacs-line), computed by threads >= 1 worker
+     threads, each computing complete blocks of consecutive clauses into
+     their own buffer; the calling thread writes the blocks in order,
+     via one out.write per block
+   - rand_clauselist(out, g, par, threads) adds the Dimacs-line.
+
+  The generator g must use the backend RB::xo, so that clause i is
+  computed from the sub-stream g.unit(i) (on a copy of g): the output is
+  then the same as for the sequential rand_clauselist_core(out, g, par)
+  from ClauseSets.hpp, for every number of threads and every block-size.
+
+  There are 2 * threads buffers (of blocksize clauses each), used
+  cyclically: a worker having taken block b waits until block b - 2*threads
+  has been written.
+
+TODOS:
+
+1. Handling exceptions in the workers
+    - Currently an exception thrown by a worker (only std::bad_alloc is
+      possible) terminates the program.
+
+*/
+
+#ifndef PARCLAUSESETS_rT5mKx2VqB
+#define PARCLAUSESETS_rT5mKx2VqB
+
+#include <ostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <charconv>
+#include <algorithm>
+#include <limits>
+
+#include <cassert>
+
+#include "Numbers.hpp"
+#include "ClauseSets.hpp"
+
+namespace RandGen {
+
+  // Writing "l1 ... lk 0\n" starting with p:
+  inline char* append(char* p, const Clause& C) noexcept {
+    constexpr int max_digits = std::numeric_limits<var_t>::digits10 + 1;
+    for (const Lit x : C) {
+      if (not x.s) *p++ = '-';
+      p = std::to_chars(p, p + max_digits, x.v.v).ptr;
+      *p++ = ' ';
+    }
+    *p++ = '0'; *p++ = '\n';
+    return p;
+  }
+
+  inline gen_uint_t num_digits(gen_uint_t n) noexcept {
+    gen_uint_t res = 1;
+    while (n >= 10) { n /= 10; ++res; }
+    return res;
+  }
+  inline gen_uint_t max_clause_chars(const rparam_v& par) noexcept {
+    gen_uint_t res = 0;
+    for (const RParam& pa : par) {
+      gen_uint_t chars = 2;
+      for (const ClausePart& cp : pa.cps)
+        chars += cp.k * (num_digits(cp.n.b()) + 2);
+      res = std::max(res, chars);
+    }
+    return res;
+  }
+
+  constexpr gen_uint_t max_block_chars = 1ULL << 22;
+  inline gen_uint_t default_blocksize(const rparam_v& par) noexcept {
+    return std::max(gen_uint_t(1), max_block_chars / max_clause_chars(par));
+  }
+
+
+  void rand_clauselist_core(std::ostream& out, const RandGen_t& g,
+                            const rparam_v& par, const unsigned threads,
+                            gen_uint_t blocksize = 0) {
+    assert(g.backend() == RB::xo);
+    assert(threads >= 1);
+    const gen_uint_t c = extract_parameters(par).c;
+    if (c == 0) return;
+    if (blocksize == 0) blocksize = default_blocksize(par);
+    const gen_uint_t nb = c / blocksize + (c % blocksize != 0);
+    const gen_uint_t T = std::min(gen_uint_t(threads), nb), W = 2 * T;
+
+    // ends[j] is the index of the first clause after clause-block par[j]:
+    std::vector<gen_uint_t> ends; ends.reserve(par.size());
+    {gen_uint_t sum = 0;
+     for (const RParam& pa : par) ends.push_back(sum += pa.c);
+    }
+
+    struct Slot {
+      std::vector<char> buf;
+      std::size_t size = 0;
+      bool ready = false;
+    };
+    std::vector<Slot> slots(W);
+    const gen_uint_t capacity = blocksize * max_clause_chars(par);
+    for (Slot& s : slots) s.buf.resize(capacity);
+
+    std::mutex m;
+    std::condition_variable cv;
+    gen_uint_t next = 0, written = 0;
+
+    const auto work = [&]{
+      RandGen_t h(g);
+      Clause C; C.reserve(max_clause_length(par));
+      for (;;) {
+        gen_uint_t b;
+        {std::unique_lock l(m);
+         if (next == nb) return;
+         b = next++;
+         cv.wait(l, [&]{ return b < written + W; });
+        }
+        Slot& s = slots[b % W];
+        const gen_uint_t first = b * blocksize,
+          last = std::min(c, first + blocksize);
+        auto j = std::ranges::upper_bound(ends, first) - ends.begin();
+        char* p = s.buf.data();
+        for (gen_uint_t i = first; i < last; ++i) {
+          while (i == ends[j]) ++j;
+          h.unit(i);
+          C.clear();
+          for (const ClausePart& cp : par[j].cps)
+            rand_clause(h, C, cp.n, cp.k, cp.p);
+          p = append(p, C);
+        }
+        assert(gen_uint_t(p - s.buf.data()) <= capacity);
+        {std::lock_guard l(m);
+         s.size = p - s.buf.data(); s.ready = true;
+        }
+        cv.notify_all();
+      }
+    };
+
+    std::vector<std::thread> workers; workers.reserve(T);
+    for (gen_uint_t t = 0; t < T; ++t) workers.emplace_back(work);
+    for (gen_uint_t b = 0; b < nb; ++b) {
+      Slot& s = slots[b % W];
+      {std::unique_lock l(m);
+       cv.wait(l, [&]{ return s.ready; });
+      }
+      out.write(s.buf.data(), s.size);
+      {std::lock_guard l(m);
+       s.ready = false; ++written;
+      }
+      cv.notify_all();
+    }
+    for (std::thread& t : workers) t.join();
+  }
+
+  void rand_clauselist(std::ostream& out, const RandGen_t& g,
+                       const rparam_v& par, const unsigned threads) {
+    const auto dp = extract_parameters(par);
+    out << dp; if (dp.c == 0) return;
+    rand_clauselist_core(out, g, par, threads);
+  }
+
+}
+
+#endif
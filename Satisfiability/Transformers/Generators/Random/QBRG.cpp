@@ -65,8 +65,8 @@ the context of the OKlibrary. Then the Git-id is just hardcoded.
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.2",
-        "27.12.2020",
+        "0.5.0",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/QBRG.cpp",
@@ -94,8 +94,8 @@ namespace {
     "     Pi    : \"N, W [, P]\", where\n"
     "              N=quantifier-block-range, W=#literals, P=#sign-probability\n"
     "   options : \"c1, ..., cl\", with l >= 0 option-choices ci from\n"
-    "               " << Environment::WRP<option_t>{} << ";\n"
-    "             defaults are the first values for both options\n"
+    "               " << Environment::WRP<extoption_t>{} << ";\n"
+    "             defaults are the first values for all options\n"
     "   seeds   : \"s1, ..., sp\", with p >= 0 seed-values si, which are\n"
     "             unsigned 64-bit integers, \"r\" (for \"random\"), or \"t\" (for \"timestamp\")\n"
     "   output  : \"-cout\" or \"[-]\" (default-filename) or [-]FILENAME\n\n"
@@ -146,7 +146,9 @@ try {
     return int(Error::invalid_clauses);
   }
 
-  const GParam gpar = (argc <= index) ? GParam{} : GParam{Environment::translate<option_t>()(argv[index++], sep)};
+  const extoption_t opt = (argc <= index) ? extoption_t{} : Environment::translate<extoption_t>()(argv[index++], sep);
+  const GParam gpar{std::get<SortO>(opt), std::get<RenameO>(opt)};
+  const RB rb = std::get<RB>(opt);
   if (gpar == GParam{}) {
     for (const auto& b : vpar) {
       if (b.c == 0) {
@@ -163,10 +165,10 @@ try {
       }
     }
   }
-  const Param par(gpar, std::move(v_interpreted));
+  const Param par(gpar, std::move(v_interpreted), rb);
   v_interpreted.clear(); // now in par.vp
 
-  vec_eseed_t s = seeds({gpar,vpar}, vblock);
+  vec_eseed_t s = seeds({gpar,vpar,rb}, vblock);
   typedef vec_eseed_t::size_type evec_size_t;
   const evec_size_t esize_system = s.size();
   const evec_size_t esize_add = argc > 4 ? add_seeds(argv[index++], s) : 0;
@@ -206,8 +208,9 @@ try {
   Environment::args_output(out, argc, argv);
   out << "\n"
       << DWW{"output"} << qu(filename) << "\n"
-      << DWW{"options"} << gpar << "\n"
-      << DWW{"num_quantifier_blocks"} << vblock.size() - 1 << "\n"
+      << DWW{"options"} << gpar << "\n";
+  if (rb != RB::mt) out << DWW{"backend"} << "\"" << rb << "\"\n";
+  out << DWW{"num_quantifier_blocks"} << vblock.size() - 1 << "\n"
       << DWW{" quantifier_blocks"};
   output_qblocks(out, vblock);
   out << "\n"
@@ -221,7 +224,7 @@ try {
     out << " " << s[i];
   out << "\n";
 
-  RandGen_t g(transform(s, SP::split));
+  RandGen_t g(s, backend(s));
 
   if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, vblock);
   else {
@@ -16,11 +16,12 @@ License, or any later version. */
   - function interprete(rparam_v, block_v).
 
  - Computing the seeds:
-  - seeds(Param, block_v).
+  - seeds(Param, block_v) (the fourth seed is the backend-flag).
 
  - The generation of random clauses:
   - rand_clauselist(ostream, RandGen_t, rparam_v, block_v)
-  - rand_qclauseset(RandGen_t, rparam_v, block_v).
+  - rand_qclauseset(RandGen_t, rparam_v, block_v); as for BRG, clause i
+    uses the unit i of the generator.
 
  - Input and output:
   - scoped enum QError.
@@ -343,7 +344,7 @@ namespace RandGen {
     v.push_back(gen_uint_t(SeedOrganisation::Logic::block_uniform_qcnf));
     v.push_back(gen_uint_t(int(par.gp)));
     v.push_back(par.vp.size());
-    v.push_back(default_thread_index);
+    v.push_back(SeedOrganisation::backend_flag(par.rb));
     assert(v.size() == first);
 
     v.push_back(vblock.size());
@@ -395,8 +396,10 @@ namespace RandGen {
     // Testing whether there is enough memory (temporary solution; better
     // to use a custome-allocator, which actually uses the allocated memory):
     F.get_allocator().deallocate(F.get_allocator().allocate(c), c);
+    gen_uint_t index = 0;
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
+        g.unit(index++);
         Clause C; C.reserve(size(pa.cps));
         for (;;) {
           C.clear();
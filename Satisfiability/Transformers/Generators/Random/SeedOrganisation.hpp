@@ -71,6 +71,16 @@ License, or any later version. */
     - add_user_seeds(given, vec_eseed_t)
 
 
+   The random backend (RandGen::RB) as flag in the seed-vector:
+
+    - backend_flag(RB) is the seed-value (0 for the Mersenne Twister, so
+      that all seed-vectors from before keep their meaning)
+    - backend(eseed_t) is the inverse.
+    For BRG, QBRG and DQBRG the flag is the fourth seed (formerly the
+    hypothetical thread-index, always 0); for LSRG it is the third generic
+    parameter, present only for RB::xo.
+
+
    Further helper-functions:
 
     - default_seeds condenses all seeds into one number (for the
@@ -83,6 +93,7 @@ License, or any later version. */
 
 #include <string>
 #include <algorithm>
+#include <stdexcept>
 
 // Guaranteed to be included:
 #include "Numbers.hpp"
@@ -215,6 +226,20 @@ namespace SeedOrganisation {
   }
 
 
+  /* The flag for the random backend */
+
+  constexpr eseed_t backend_flag(const RandGen::RB b) noexcept {
+    return eseed_t(b);
+  }
+  inline RandGen::RB backend(const eseed_t f) {
+    if (f > eseed_t(RandGen::RB::xo))
+      throw std::domain_error("SeedOrganisation::backend: flag = " +
+                              std::to_string(f));
+    return RandGen::RB(f);
+  }
+  static_assert(backend_flag(RandGen::RB::mt) == 0);
+
+
   // Accumulating all seeds into one number (for a filename):
   std::string default_seeds(const RandGen::vec_eseed_t& s) {
     return std::to_string(std::accumulate(
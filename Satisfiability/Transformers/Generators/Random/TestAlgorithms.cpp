@@ -8,6 +8,9 @@ License, or any later version. */
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <algorithm>
+
+#include <cassert>
 
 #include <ProgramOptions/Environment.hpp>
 
@@ -17,8 +20,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.2.14",
-        "19.5.2019",
+        "0.2.15",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/Algorithms.cpp",
@@ -104,4 +107,21 @@ int main(const int argc, const char* const argv[]) {
    }
   }
 
+  // choose_kn_small yields the same results as choose_kn:
+  {RandGen_t g1({7}), g2({7});
+   for (gen_uint_t k = 0; k <= max_small_k; ++k)
+     for (const gen_uint_t n : {gen_uint_t(0), k, k+1, 2*k-1, 2*k, 2*k+1,
+                                gen_uint_t(40), gen_uint_t(1000),
+                                gen_uint_t(-1)})
+       for (const bool sorted : {false, true})
+         for (unsigned r = 0; r < 20; ++r) {
+           const auto v = choose_kn(k, n, g1, sorted);
+           small_choice_t w;
+           const auto size = choose_kn_small(k, n, g2, w.data(), sorted);
+           assert(size == v.size());
+           assert(std::equal(v.begin(), v.end(), w.begin()));
+         }
+   assert(g1 == g2);
+  }
+
 }
@@ -8,6 +8,7 @@ License, or any later version. */
 #include <iostream>
 #include <string_view>
 #include <sstream>
+#include <algorithm>
 
 #include <cassert>
 
@@ -18,8 +19,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.1",
-        "13.3.2022",
+        "0.3.3",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestClauseSets.cpp",
@@ -183,8 +184,10 @@ int main(const int argc, const char* const argv[]) {
      const auto ro = RenameO(i);
      for (int j = 0; j < size_s; ++j) {
        const auto so = SortO(j);
-       const GParam p(k++);
+       // SortO::hashed comes last:
+       const GParam p(so == SortO::hashed ? GParam::size_classical + i : k++);
        assert(p == GParam(so, ro));
+       assert(GParam(int(p)) == p);
        assert((pair_t(p) == pair_t{so,ro}));
        std::stringstream s;
        s << p;
@@ -201,6 +204,22 @@ int main(const int argc, const char* const argv[]) {
     assert((seeds(Param{GParam(1), {{{{10,3,Prob64{1,3}}},15}}}) ==
       vec_eseed_t{0,1,1,0,  15,1,1,10,3,1,3}));
     assert((seeds(Param{{SortO::sorted,RenameO::maxindex}, {{{{{3,22},7}},11}, {{{20,2,Prob64{4,16}}},4}}}) == vec_eseed_t{0,4,2,0, 11,1,3,22,7,1,2, 4,1,1,20,2,1,4}));
+    const vec_eseed_t s = seeds(Param{GParam(1), {}, RB::xo});
+    assert((s == vec_eseed_t{0,1,0,1}));
+    assert(backend(s) == RB::xo);
+    assert(backend(seeds(p1)) == RB::mt);
+   }
+   {const auto t = Environment::translate<option_t>()("h,m", sep);
+    assert(std::get<SortO>(t) == SortO::hashed);
+    assert(int(GParam(t)) == 10);
+    std::ostringstream out; out << GParam(t);
+    assert(out.str() == "\"hashed,maxindex\"");
+   }
+   {const auto t = Environment::translate<extoption_t>()("u,xo,o", sep);
+    assert(std::get<SortO>(t) == SortO::unsorted);
+    assert(std::get<RenameO>(t) == RenameO::original);
+    assert(std::get<RB>(t) == RB::xo);
+    assert(std::get<RB>(Environment::translate<extoption_t>()("s", sep)) == RB::mt);
    }
   }
 
@@ -303,6 +322,102 @@ int main(const int argc, const char* const argv[]) {
    assert((F.second.back() == Clause{{13,-1}}));
   }
 
+  // With the xo-backend, clause i is a pure function of the seeds and i:
+  {const rparam_v par{{{{{2,9},3u}},6}, {{{20,4,Prob64{1,3}}},7}};
+   const vec_eseed_t s = seeds(Param{GParam(-1), par, RB::xo});
+   RandGen_t g(s, RB::xo);
+   const auto F = rand_clauselist(g, par).first.second;
+   assert(F.size() == 13);
+   for (gen_uint_t i = 13; i != 0; --i) {
+     RandGen_t h(s, RB::xo);
+     h.unit(i-1);
+     Clause C;
+     const RParam& pa = i <= 6 ? par[0] : par[1];
+     for (const ClausePart& cp : pa.cps) rand_clause(h, C, cp.n, cp.k, cp.p);
+     assert(C == F[i-1]);
+   }
+   RandGen_t g2(s, RB::xo);
+   std::ostringstream out;
+   rand_clauselist_core(out, g2, par);
+   std::ostringstream out2;
+   for (const auto& C : F) out2 << C;
+   assert(out.str() == out2.str());
+   RandGen_t g3(s, RB::xo);
+   const auto F2 = rand_clauseset(g3, par).first.second;
+   assert(F2.size() == 13);
+  }
+
+  {HashedClauseList F;
+   assert(F.size() == 0);
+   assert(F.insert({{2,1},{5,-1}}));
+   assert(F.insert({}));
+   assert(F.insert({{1,-1}}));
+   assert(not F.insert({{2,1},{5,-1}}));
+   assert(not F.insert({}));
+   assert(F.insert({{2,1},{5,1}}));
+   for (unsigned v = 10; v < 100; ++v) assert(F.insert({{v,1}}));
+   for (unsigned v = 10; v < 100; ++v) assert(not F.insert({{v,1}}));
+   assert(F.size() == 94);
+   assert(F.length(0) == 2 and F.length(1) == 0 and F.length(2) == 1);
+   assert(F.max_var_index() == 99);
+   const ClauseList L = F.clauselist();
+   assert(L.size() == 94);
+   assert((L[0] == Clause{{2,1},{5,-1}}));
+   assert((L[3] == Clause{{2,1},{5,1}}));
+   std::ostringstream out1, out2;
+   out1 << F;
+   for (const Clause& C : L) out2 << C;
+   assert(out1.str() == out2.str());
+   F.finish();
+   const auto R = F.rename();
+   assert(R.first == 93);
+   assert(F.max_var_index() == 93);
+   assert((F.clauselist()[3] == Clause{{2,1},{3,1}}));
+  }
+  {const rparam_v par{{{{5,3}},10}, {{{6,2}},15}};
+   for (const RB b : {RB::mt, RB::xo}) {
+     const vec_eseed_t s = seeds(Param{{SortO::hashed, RenameO::original}, par, b});
+     RandGen_t g1(s, b), g2(s, b);
+     const auto F1 = rand_clauseset(g1, par).first;
+     const auto F2 = rand_hashedclauselist(g2, par).first;
+     assert(F1.first == F2.first);
+     ClauseList L = F2.second.clauselist();
+     assert(L.size() == 25);
+     std::sort(L.begin(), L.end());
+     assert(L == F1.second);
+     assert(g1 == g2);
+   }
+  }
+
+  {// HashedClauseList::rename against rename_clauselist for the (sorted)
+   // clause-set, with many variables not occurring:
+   const rparam_v par{{{{100,3}},10}, {{{60,2}},5}};
+   for (const RB b : {RB::mt, RB::xo}) {
+     const vec_eseed_t s = seeds(Param{{SortO::hashed, RenameO::original}, par, b});
+     RandGen_t g1(s, b);
+     const auto F1 = rand_clauseset(g1, par).first;
+     assert(F1.first == (dimacs_pars{100,15}));
+     ClauseList F2 = F1.second;
+     const rename_info_t R2 = rename_clauselist(F2, true);
+     assert(R2.first < 100 and not R2.second.empty());
+     RandGen_t g3(s, b);
+     const auto R3 = rand_hashedclauselist(g3, par, RenameO::renamed);
+     assert(R3.first.first == (dimacs_pars{R2.first,15}));
+     assert(R3.second == R2);
+     ClauseList L = R3.first.second.clauselist();
+     std::sort(L.begin(), L.end());
+     assert(L == F2);
+     RandGen_t g4(s, b);
+     const auto R4 = rand_hashedclauselist(g4, par, RenameO::maxindex);
+     const gen_uint_t m = max_var_index(F1.second, true);
+     assert(R4.first.first == (dimacs_pars{m,15}));
+     assert(R4.second == (rename_info_t{m,{}}));
+     L = R4.first.second.clauselist();
+     std::sort(L.begin(), L.end());
+     assert(L == F1.second);
+   }
+  }
+
   {assert(valid(DimacsClauseList{}));
    assert(valid(DimacsClauseList{{5,0},{}}));
    assert(not valid(DimacsClauseList{{0,1},{}}));
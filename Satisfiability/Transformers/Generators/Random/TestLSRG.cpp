@@ -122,4 +122,15 @@ int main(const int argc, const char* const argv[]) {
      {3,8,7,9,1,6,0,2,5,4}}));
   }
 
+  {const Dim D{4};
+   const auto s0 = basic_seeds(D, {Selection(4)}, GenO::jm, StRLS::none);
+   assert(s0 == basic_seeds(D, {Selection(4)}, GenO::jm, StRLS::none, RG::RB::mt));
+   const auto s1 = basic_seeds(D, {Selection(4)}, GenO::jm, StRLS::none, RG::RB::xo);
+   assert(s1.size() == s0.size() + 1);
+   assert(s1[SO::size_first_part-1] == s0[SO::size_first_part-1] + 1);
+   assert(s1[SO::size_first_part+2] == SO::backend_flag(RG::RB::xo));
+   const auto L = random_ls(4, Selection(4), GenO::jm, StRLS::none, s1, RG::RB::xo);
+   assert(valid(L));
+   assert(L == random_ls(4, Selection(4), GenO::jm, StRLS::none, s1, RG::RB::xo));
+  }
 }
@@ -20,8 +20,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.5.4",
-        "15.1.2021",
+        "0.5.5",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestLatinSquares.cpp",
@@ -468,6 +468,74 @@ int main(const int argc, const char* const argv[]) {
      assert(valid(jm(N,g)));
   }
 
+  {for (ls_dim_t N = 1; N <= 4; ++N) {
+     const JMState S(cyclic_ls(N));
+     assert(S.N() == N);
+     assert(S.proper());
+     assert(S.ls() == cyclic_ls(N));
+     assert(S.ip() == ls2lsip(cyclic_ls(N)));
+   }
+  }
+  // JMState yields the same results as ls_ip_t:
+  {RG::RandGen_t g, h;
+   for (ls_dim_t N = 1; N <= 12; ++N) {
+     ls_ip_t I = ls2lsip(cyclic_ls(N));
+     JMState S(cyclic_ls(N));
+     for (ls_dim_t i = 0; i < 200; ++i) {
+       assert(jm_next(I, g) == jm_next(S, h));
+       assert(S.proper());
+       assert(S.ip() == I);
+       assert(g == h);
+     }
+     assert(S.ls() == lsip2ls(I));
+   }
+   // Comparing also the improper states:
+   for (ls_dim_t N = 3; N <= 8; ++N) {
+     ls_ip_t I = ls2lsip(cyclic_ls(N));
+     JMState S(cyclic_ls(N));
+     for (ls_dim_t i = 0; i < 200; ++i) {
+       triple_t r = find_zero(I, g);
+       assert(S.find_zero(h) == r);
+       triple_t o = find_ones(I, r);
+       move(I, r, o);
+       S.move(r);
+       assert(S.ip() == I);
+       for (; I[o[0]][o[1]][o[2]] == -1;) {
+         assert(not S.proper());
+         r = o;
+         const auto p = find_both_ones(I, r);
+         for (ls_dim_t i = 0; i < 3; ++i) o[i] = p[bernoulli(g)][i];
+         move(I, r, o);
+         S.move(h);
+         assert(S.ip() == I);
+       }
+       assert(S.proper());
+     }
+   }
+   for (ls_dim_t N = 1; N <= 12; ++N) {
+     const ls_t L = jm_ls(N, h);
+     assert(L == lsip2ls(jm(N, g)));
+     assert(valid(L));
+     assert(jm_ls(L, h) == lsip2ls(jm(L, g)));
+   }
+   assert(g == h);
+  }
+
+  // The result of jm_batch is independent of the number of threads:
+  {const RG::RandGen_t g(RG::vec_eseed_t{1,2,3}, RG::RB::xo);
+   for (const ls_dim_t N : {1, 2, 3, 7}) {
+     const auto B = jm_batch(N, 20, g, 1);
+     assert(B.size() == 20);
+     for (std::uint64_t i = 0; i < B.size(); ++i) {
+       RG::RandGen_t h(g); h.unit(i);
+       assert(B[i] == jm_ls(N, h));
+     }
+     for (const unsigned T : {2, 3, 25})
+       assert(jm_batch(N, 20, g, T) == B);
+   }
+   assert(jm_batch(5, 0, g, 3).empty());
+  }
+
   {Selection s{1,0,0,0};
    assert(s.N == 1);
    assert(s.r == 1);
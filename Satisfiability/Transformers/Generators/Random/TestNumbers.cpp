@@ -15,8 +15,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.1",
-        "22.3.2022",
+        "0.3.2",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestNumbers.cpp",
@@ -246,4 +246,34 @@ int main(const int argc, const char* const argv[]) {
   {assert(to_eseed("12345678901") == 12345678901ULL);
   }
 
+  {xoshiro256_t g({1,2,3,4});
+   assert(g() == 11520);
+   assert(g() == 0);
+   assert(g() == 1509978240);
+   assert(g() == 1215971899390074240ULL);
+  }
+  {const xoshiro256_t::state_t k = init_key({1,2});
+   assert(k == init_key({1,2}));
+   assert(k != init_key({1,3}));
+   assert(substream(k,0) == substream(k,0));
+   assert(substream(k,0) != substream(k,1));
+   assert(substream(k,1) != substream(init_key({1,3}),1));
+  }
+  {RandGen_t g1(vec_eseed_t{1,2}, RB::xo), g2(vec_eseed_t{1,2}, RB::xo);
+   assert(g1.backend() == RB::xo);
+   assert(g1 == g2);
+   const gen_uint_t x0 = g1();
+   assert(g1 != g2);
+   g1(); g1();
+   g2.unit(5); const gen_uint_t x5 = g2();
+   g1.unit(0); assert(g1() == x0);
+   g1.unit(5); assert(g1() == x5);
+   RandGen_t g3(vec_eseed_t{1,2}), g4(vec_eseed_t{1,2}, RB::mt);
+   assert(g3.backend() == RB::mt);
+   assert(g3 == g4);
+   g3.unit(5); assert(g3 == g4);
+   assert(g3() == g4());
+   assert(g3 != g1);
+  }
+
 }
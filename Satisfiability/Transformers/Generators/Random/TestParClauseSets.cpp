@@ -0,0 +1,84 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <cassert>
+
+#include <ProgramOptions/Environment.hpp>
+
+#include "ClauseSets.hpp"
+#include "ParClauseSets.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.0.1",
+        "17.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestParClauseSets.cpp",
+        "GPL v3"};
+
+  using namespace RandGen;
+
+  std::string str(const Clause& C) {
+    char buf[256];
+    return std::string(buf, append(buf, C));
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv))
+  return 0;
+
+  {assert(str({}) == "0\n");
+   assert(str({{1,1}}) == "1 0\n");
+   assert(str({{3,-1},{10,1},{18446744073709551615ULL,-1}}) ==
+          "-3 10 -18446744073709551615 0\n");
+  }
+
+  {assert(num_digits(0) == 1);
+   assert(num_digits(9) == 1);
+   assert(num_digits(10) == 2);
+   assert(num_digits(18446744073709551615ULL) == 20);
+   assert(max_clause_chars({}) == 0);
+   assert(max_clause_chars({{{{{2,9},3u}},6}, {{{20,4}},7}}) == 18);
+   assert(default_blocksize({{{{1000,3}},1}}) == (1ULL << 22) / 20);
+  }
+
+  // The output is independent of the number of threads and the block-size:
+  {const rparam_v par{{{{{2,9},3u}},6}, {{{20,4,Prob64{1,3}}},0},
+                      {{{30,2},{{40,50},3}},1000}};
+   const vec_eseed_t s = seeds(Param{GParam(-1), par, RB::xo});
+   RandGen_t g(s, RB::xo);
+   std::ostringstream out;
+   rand_clauselist_core(out, g, par);
+   const std::string F = out.str();
+   for (const unsigned T : {1, 2, 3, 7})
+     for (const gen_uint_t B : {0, 1, 5, 6, 1005, 2000}) {
+       const RandGen_t h(s, RB::xo);
+       std::ostringstream out2;
+       rand_clauselist_core(out2, h, par, T, B);
+       assert(out2.str() == F);
+     }
+   const RandGen_t h(s, RB::xo);
+   std::ostringstream out2, out3;
+   rand_clauselist(out2, h, par, 4);
+   out3 << extract_parameters(par) << F;
+   assert(out2.str() == out3.str());
+  }
+  {const RandGen_t g(vec_eseed_t{}, RB::xo);
+   std::ostringstream out;
+   rand_clauselist(out, g, {}, 3);
+   assert(out.str() == "p cnf 0 0\n");
+  }
+
+}
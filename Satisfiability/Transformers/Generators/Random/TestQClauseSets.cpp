@@ -99,4 +99,17 @@ int main(const int argc, const char* const argv[]) {
    assert((not valid(Qvector{Q::fa,Q::fa,Q::ex,Q::fa}, false)));
    assert((not valid(Qvector{Q::ex,Q::fa,Q::ex,Q::fa}, false)));
   }
+  {const block_v bv = read_block_v("a3 6");
+   const rparam_v par = interprete(read_rparam_v("10*1-2,3"), bv);
+   for (const RB b : {RB::mt, RB::xo}) {
+     const vec_eseed_t s = seeds(Param{GParam{}, par, b}, bv);
+     assert(s[3] == SeedOrganisation::backend_flag(b));
+     assert(backend(s) == b);
+     RandGen_t g1(s, b), g2(s, b);
+     const auto F1 = rand_qclauseset(g1, par, bv);
+     assert(F1.first.second.size() == 10);
+     if (b == RB::xo) g2.discard(5); // clause i uses unit i
+     assert(rand_qclauseset(g2, par, bv) == F1);
+   }
+  }
 }
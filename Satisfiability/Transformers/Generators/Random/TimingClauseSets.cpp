@@ -0,0 +1,131 @@
+// Oliver Kullmann, 17.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/* Timing and memory-usage for the duplicate-free clause-lists
+
+Random> ./TimingClauseSets S=h c=1e7 n=1e6 k=3
+
+computes the random clause-list with c clauses of length k over n variables,
+for sort-option S (from f, s, h, u), with original variable-names and
+default seeds, outputting S, c (without duplicates), a checksum of the
+clauses (as sum of the packed literals, each multiplied with its position
+in the clause-list), the wall-clock time in seconds for the computation
+(without the output), and the maximal resident set size in MB.
+
+
+Results:
+
+On a 2026 test-machine (g++ 12.2), with n=1e6, k=3:
+
+Random> for S in f s h u; do ./TimingClauseSets $S 1e6; done
+f 1000000 5142898803788607524 2.46454 170
+s 1000000 5142898803788607524 0.777761 85
+h 1000000 4500417802243677971 0.401002 39
+u 1000000 4500417802243677971 0.191593 85
+Random> for S in f s h u; do ./TimingClauseSets $S 1e7; done
+f 10000000 16218065049080799710 48.7345 1606
+s 10000000 16218065049080799710 10.6906 840
+h 10000000 7312846954390013273 5.2424 434
+u 10000000 7312846954390013273 1.90538 840
+
+So for "h" the memory is around 43 bytes per clause (8 bytes per literal,
+8 bytes for the offset, and 8 * 2^25 / 10^7 ~ 27 bytes for the hash-table),
+while for "f" it is around 160 bytes per clause (the std::set, followed
+by the ClauseList), and for "s" and "u" (just the ClauseList) around 84
+bytes; the time for "h" is around a tenth of the time for "f", and half
+of the time for "s" (for "s" and "f" the clauses are sorted, for "h" and
+"u" they are in the order of creation).
+
+Before the ClauseList was moved into the result (instead of being
+copied), the maximal resident set sizes for c=1e7 were 2518 MB for "f",
+and 2519 MB for "s" and "u".
+
+*/
+
+#include <iostream>
+#include <chrono>
+
+#include <sys/resource.h>
+
+#include <Numerics/FloatingPoint.hpp>
+#include <ProgramOptions/Environment.hpp>
+
+#include "ClauseSets.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.0",
+        "17.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TimingClauseSets.cpp",
+        "GPL v3"};
+
+  using namespace RandGen;
+
+  constexpr gen_uint_t c_default = 1e7, n_default = 1e6, k_default = 3;
+
+  typedef HashedClauseList::packed_t packed_t;
+
+  gen_uint_t checksum(const ClauseList& F) noexcept {
+    gen_uint_t sum = 0, pos = 0;
+    for (const Clause& C : F)
+      for (const Lit x : C) sum += ++pos * HashedClauseList::pack(x);
+    return sum;
+  }
+  gen_uint_t checksum(const HashedClauseList& F) noexcept {
+    gen_uint_t sum = 0, pos = 0;
+    for (gen_uint_t i = 0; i < F.size(); ++i)
+      for (const packed_t* p = F.begin(i); p != F.begin(i)+F.length(i); ++p)
+        sum += ++pos * *p;
+    return sum;
+  }
+
+  long max_rss_MB() noexcept {
+    struct rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return u.ru_maxrss / 1024;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv))
+  return 0;
+
+  Environment::Index index;
+  const SortO S = argc <= index ? SortO::hashed :
+    Environment::read<SortO>(argv[index++]).value_or(SortO::hashed);
+  const gen_uint_t c = argc <= index ? c_default :
+    FloatingPoint::toUInt(argv[index++]);
+  const gen_uint_t n = argc <= index ? n_default :
+    FloatingPoint::toUInt(argv[index++]);
+  const gen_uint_t k = argc <= index ? k_default :
+    FloatingPoint::toUInt(argv[index++]);
+  index.deactivate();
+
+  const rparam_v par{{{{n,k}}, c}};
+  RandGen_t g;
+  const auto start = std::chrono::steady_clock::now();
+  gen_uint_t size, sum;
+  if (S == SortO::hashed) {
+    const auto F = rand_hashedclauselist(g, par).first.second;
+    size = F.size(); sum = checksum(F);
+  }
+  else {
+    const auto F = S == SortO::unsorted ? rand_clauselist(g, par) :
+      S == SortO::sorted ? rand_sortedclauselist(g, par) :
+      rand_clauseset(g, par);
+    size = F.first.second.size(); sum = checksum(F.first.second);
+  }
+  const std::chrono::duration<double> t =
+    std::chrono::steady_clock::now() - start;
+  std::cout << Environment::RegistrationPolicies<SortO>::string[int(S)]
+            << " " << size << " " << sum << " " << t.count() << " "
+            << max_rss_MB() << "\n";
+}
@@ -70,6 +70,38 @@ N=576
 ks:       0.045552862719373356248         0.1775361818682745511
 
 
+Timing the Jacobson-Matthews generator:
+
+Random> ./TimingLSRG jm N T threads
+
+outputs N, T, threads, the time for T squares via ls_ip_t (jm, scanning
+lines), the time via JMState (jm_ls, constant-time steps; the squares must
+be the same, which is checked via hashing the sequences of squares with
+mix64 -- a difference is reported as an error, with return-code 1), the
+speedup, the time via jm_batch(N, T, threads) (backend
+xoshiro-substreams), and the hash-value of the batch.
+
+On a 2026 test-machine (g++ 12.2, one core):
+
+Random> for a in "5 10000" "10 1000" "20 200" "50 20" "100 5"; do ./TimingLSRG jm $a 1; done
+5 10000 1 0.69655 0.399925 1.7417 0.379994 106140928798591296
+10 1000 1 1.35041 0.700928 1.92661 0.575385 7343503489269947692
+20 200 1 5.73196 1.9387 2.9566 1.71811 13328328673288667693
+50 20 1 31.154 8.17402 3.81134 5.82929 7666956502601213054
+100 5 1 400.401 35.2888 11.3464 25.8616 6938605614938943285
+Random> ./TimingLSRG jm 20 200 2
+20 200 2 5.94372 2.29785 2.58664 1.91552 13328328673288667693
+
+(Earlier runs yielded the speedups 1.78, 2.07, 2.76, 3.96, 13.3, and
+1.90, 2.16, 2.80, 7.60, 9.61; the machine is noisy.)
+A round of jm_next (of which there are N^3) performs around N-1 improper
+steps on average (for N = 50 there were 6124165 improper steps in 125000
+rounds); each of them uses 3 random bits, which dominates now, while for
+ls_ip_t each step scans 3 lines of length N. The batch-version is faster
+due to the xoshiro256**-generator; for more than one core the
+time for the batch should be divided by the number of threads.
+
+
 TODOS:
 
 1. Use exact computation for the p-values.
@@ -79,6 +111,7 @@ TODOS:
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <chrono>
 
 #include <ProgramOptions/Environment.hpp>
 #include <Numerics/FloatingPoint.hpp>
@@ -90,8 +123,8 @@ TODOS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.4",
-        "28.4.2021",
+        "0.5.0",
+        "17.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TimingLSRG.cpp",
@@ -105,30 +138,100 @@ namespace {
   constexpr LS::ls_dim_t N_def = 4;
   typedef RG::gen_uint_t count_t;
   constexpr count_t T_default = 10'000;
+  constexpr count_t T_jm_default = 100;
 
   bool show_usage(const int argc, const char* const argv[]) {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
       return false;
     std::cout <<
-    "> " << proginfo.prg << " [N] [T] [option] [seeds]\n\n"
+    "> " << proginfo.prg << " [N] [T] [option] [seeds]\n"
+    "> " << proginfo.prg << " jm [N] [T] [threads]\n\n"
     " N       : default = " << N_def << "\n"
     " T       : default = " << T_default << "\n"
     " options : " << Environment::WRP<LS::StRLS>{} << "\n"
     "           " << Environment::WRP<GenO>{} << "\n"
+    "           " << Environment::WRP<RG::RB>{} << "\n"
     " seeds   : ";
     RG::explanation_seeds(std::cout, 11);
     std::cout << "\n"
     " generates T random Latin square of order N and tests them.\n"
+    " With \"jm\" the Jacobson-Matthews generator is timed (for T squares,\n"
+    "  default T = " << T_jm_default << ", threads default = 1).\n"
 ;
     return true;
   }
 
+  // Hashing the sequence of squares, updating h with square L (via mix64,
+  // so that (with high probability) different sequences yield different
+  // hash-values):
+  void hash(RG::gen_uint_t& h, const LS::ls_t& L) noexcept {
+    for (const auto& r : L) for (const auto x : r) h = RG::mix64(h ^ x);
+    h = RG::mix64(h + 1);
+  }
+
+  double since(const std::chrono::steady_clock::time_point start) noexcept {
+    const std::chrono::duration<double> t =
+      std::chrono::steady_clock::now() - start;
+    return t.count();
+  }
+
+  // Output "N T threads t_ip t_flat t_ip/t_flat t_batch hash":
+  void time_jm(const int argc, const char* const argv[]) {
+    Environment::Index index; index++;
+    const LS::ls_dim_t N = argc <= index ? N_def :
+      FloatingPoint::touint(argv[index++]);
+    const count_t T = argc <= index ? T_jm_default :
+      FloatingPoint::toUInt(argv[index++]);
+    const unsigned threads = argc <= index ? 1 :
+      FloatingPoint::touint(argv[index++]);
+    index.deactivate();
+    if (threads == 0) {
+      std::cerr << "ERROR[" << proginfo.prg << "]: threads = 0.\n";
+      std::exit(1);
+    }
+
+    const RG::vec_eseed_t seeds{N, T};
+    RG::gen_uint_t hash_ip = 0, hash_flat = 0, hash_batch = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    {RG::RandGen_t g(seeds);
+     for (count_t i = 0; i < T; ++i)
+       hash(hash_ip, LS::lsip2ls(LS::jm(N, g)));
+    }
+    const double t_ip = since(start);
+
+    start = std::chrono::steady_clock::now();
+    {RG::RandGen_t g(seeds);
+     for (count_t i = 0; i < T; ++i) hash(hash_flat, LS::jm_ls(N, g));
+    }
+    const double t_flat = since(start);
+    if (hash_ip != hash_flat) {
+      std::cerr << "ERROR[" << proginfo.prg << "]: the squares of jm and "
+        "jm_ls differ (hash-values " << hash_ip << " and " << hash_flat <<
+        ").\n";
+      std::exit(1);
+    }
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& L :
+           LS::jm_batch(N, T, RG::RandGen_t(seeds, RG::RB::xo), threads))
+      hash(hash_batch, L);
+    const double t_batch = since(start);
+
+    std::cout << N << " " << T << " " << threads << " " << t_ip << " "
+              << t_flat << " " << t_ip / t_flat << " " << t_batch << " "
+              << hash_batch << std::endl;
+  }
+
 }
 
 int main(const int argc, const char* const argv[]) {
 
   if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
   if (show_usage(argc, argv)) return 0;
+  if (argc >= 2 and std::string_view(argv[1]) == "jm") {
+    time_jm(argc, argv); return 0;
+  }
 
   Environment::Index index;
 
@@ -145,12 +248,13 @@ int main(const int argc, const char* const argv[]) {
     Environment::translate<option_t>()(argv[index++], sep);
   const LS::StRLS sto = std::get<LS::StRLS>(options);
   const GenO geo = std::get<GenO>(options);
+  const RG::RB rb = std::get<RG::RB>(options);
 
   const std::string ss = argc <= index ? "" : argv[index++];
 
   index.deactivate();
 
-  RG::vec_eseed_t seeds = basic_seeds(N, {LS::Selection(N)}, geo, sto);
+  RG::vec_eseed_t seeds = basic_seeds(N, {LS::Selection(N)}, geo, sto, rb);
   seeds.push_back(T);
   SO::add_user_seeds(seeds, ss);
   seeds.push_back(0);
@@ -167,6 +271,7 @@ int main(const int argc, const char* const argv[]) {
             << DWW{"T"} << T << "\n"
             << DWW{"std-option"} << sto << "\n"
             << DWW{"gen-option"} << geo << "\n"
+            << DWW{"backend"} << rb << "\n"
             << DWW{"num_e-seeds"} << seeds.size() << "\n"
             << DWW{" e-seeds"} << RG::ESW{seeds} << "\n" << std::endl;
 
@@ -175,7 +280,7 @@ int main(const int argc, const char* const argv[]) {
   RG::UniformRange u_comp(g_comp, experiment.total);
   std::vector<RG::gen_uint_t> counts(experiment.total);
   for (; seeds.back() < T; ++seeds.back()) {
-    experiment.add(random_ls(N, LS::Selection(N), geo, sto, seeds));
+    experiment.add(random_ls(N, LS::Selection(N), geo, sto, seeds, rb));
     ++counts[u_comp()];
   }
   assert(experiment.count_all == T);